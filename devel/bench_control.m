@@ -0,0 +1,459 @@
+## Performance benchmarks of the oct-file layer and the high-level functions.
+##
+## Every case runs on stable random systems of the orders given by "sizes"
+## with 2 inputs and 2 outputs, and on the bundled models given by "models".
+## The cases are tagged with the __sl_*__ wrappers they exercise; a summary
+## lists the wrappers which are not covered.  Timings are the minimum and
+## median wall time of "repeat" runs after one warm-up run.  If the package
+## was built with profiling (__control_profile__), the time spent in the
+## SLICOT, LAPACK and BLAS calls and the routines called are recorded, too.
+##
+## Usage:  run from the package directory after installation,
+##
+##   res = bench_control ()
+##   res = bench_control ("sizes", [10, 100], "repeat", 3, "filter", "care|lyap")
+##   bench_control ("output", "base.json")           # store a baseline
+##   [res, nreg] = bench_control ("baseline", "base.json", "tolerance", 1.2)
+##
+## Options:
+##   "sizes"      orders of the random systems, default [10, 50, 200]
+##   "models"     cell of bundled models, default
+##                {"WestlandLynx", "Boeing707", "BMWengine"}
+##   "repeat"     number of timed runs, default 5
+##   "filter"     regular expression for the case names, default all
+##   "output"     write the results to a .json or .csv file
+##   "baseline"   compare with the results in a .json or .csv file
+##   "tolerance"  ratio of the median times above which a case counts as
+##                regression, default 1.25
+##   "isa"        variant of the oct-files, "baseline", "avx2" or "avx512",
+##                default the one selected when the package was loaded,
+##                see __control_isa__ and bench_isa
+##
+## nreg is the number of regressions, e.g. for  exit (nreg > 0).
+
+function [res, nreg] = bench_control (varargin)
+
+  pkg load control
+
+  sizes = [10, 50, 200];
+  models = {"WestlandLynx", "Boeing707", "BMWengine"};
+  repeat = 5;
+  filt = "";
+  output = "";
+  baseline = "";
+  tolerance = 1.25;
+  variant = "";
+
+  for k = 1 : 2 : numel (varargin)
+    val = varargin{k+1};
+    switch (lower (varargin{k}))
+      case "sizes"
+        sizes = val;
+      case "models"
+        models = val;
+      case "repeat"
+        repeat = val;
+      case "filter"
+        filt = val;
+      case "output"
+        output = val;
+      case "baseline"
+        baseline = val;
+      case "tolerance"
+        tolerance = val;
+      case "isa"
+        variant = val;
+      otherwise
+        error ("bench_control: invalid option '%s'", varargin{k});
+    endswitch
+  endfor
+
+  cases = bench_cases ();
+  if (! isempty (filt))
+    cases = cases(! cellfun (@isempty, regexp ({cases.name}, filt, "once")));
+  endif
+
+  if (! isempty (variant))
+    __control_isa__ (variant);
+  endif
+
+  profile = exist ("__control_slicot_riccati__") == 3;
+  if (profile)
+    old_profile = __control_profile__ ("on");
+  endif
+
+  systems = [num2cell(sizes), models];
+  res = struct ("case", {}, "size", {}, "n", {}, "min", {}, "median", {},
+                "slicot", {}, "routines", {}, "error", {});
+
+  printf ("%-24s %-14s %6s %12s %12s %10s\n",
+          "case", "size", "n", "min [s]", "median [s]", "slicot");
+
+  for s = 1 : numel (systems)
+    G = bench_system (systems{s});
+    n = rows (G.a);
+    if (ischar (systems{s}))
+      label = systems{s};
+    else
+      label = sprintf ("%d", systems{s});
+    endif
+
+    for c = 1 : numel (cases)
+      r = struct ("case", cases(c).name, "size", label, "n", n, "min", NaN,
+                  "median", NaN, "slicot", NaN, "routines", "", "error", "");
+
+      try
+        randn ("state", 42);
+        rand ("state", 42);
+        args = cases(c).setup (G);
+        out = cases(c).run (args{:});       # warm-up
+
+        if (profile)
+          __control_profile__ ("reset");
+        endif
+
+        t = zeros (repeat, 1);
+        for k = 1 : repeat
+          tic;
+          out = cases(c).run (args{:});
+          t(k) = toc;
+        endfor
+
+        r.min = min (t);
+        r.median = median (t);
+
+        if (profile)
+          tab = __control_profile__ ();
+          r.slicot = sum ([tab.time]) / repeat;
+          r.routines = strjoin (sort ({tab.routine}), " ");
+        endif
+      catch err
+        r.error = err.message;
+      end_try_catch
+
+      res(end+1) = r;
+
+      if (isempty (r.error))
+        printf ("%-24s %-14s %6d %12.4g %12.4g %9.0f%%\n", r.case, r.size,
+                n, r.min, r.median, 100 * r.slicot / r.median);
+      else
+        printf ("%-24s %-14s %6d   error: %s\n", r.case, r.size, n, r.error);
+      endif
+    endfor
+  endfor
+
+  if (profile && ! old_profile)
+    __control_profile__ ("off");
+  endif
+
+  if (! isempty (variant))
+    __control_isa__ ();
+  endif
+
+  ## wrappers which no case exercises, from the autoloads of the package
+  pkgadd = fullfile (fileparts (which ("__control_slicot_riccati__")), "PKG_ADD");
+  if (exist (pkgadd, "file"))
+    wrappers = unique (regexp (fileread (pkgadd), "__sl_\\w+?__", "match"));
+    missing = setdiff (wrappers, [cases.wrappers]);
+    if (! isempty (missing))
+      printf ("\nnot covered: %s\n", strjoin (missing, " "));
+    endif
+  endif
+
+  if (! isempty (output))
+    bench_write (output, res);
+  endif
+
+  nreg = 0;
+  if (! isempty (baseline))
+    nreg = bench_compare (res, bench_read (baseline), tolerance);
+  endif
+
+endfunction
+
+
+## stable random system of order n with 2 inputs and 2 outputs, or a bundled model
+function G = bench_system (n)
+
+  if (ischar (n))
+    G = ss (feval (n));
+    return;
+  endif
+
+  randn ("state", n);
+  a = randn (n, n);
+  a -= (max (real (eig (a))) + 1) * eye (n);
+  G = ss (a, randn (n, 2), randn (2, n), randn (2, 2));
+
+endfunction
+
+
+function c = bench_cases ()
+
+  w = logspace (-2, 3, 500);
+
+  c = struct ("name", {}, "wrappers", {}, "setup", {}, "run", {});
+
+  ## time and frequency responses
+  c(end+1) = bench_case ("lsim", {},
+    @(G) {G, randn (1001, size (G, 2)), 0:0.01:10}, @(G, u, t) lsim (G, u, t));
+  c(end+1) = bench_case ("step", {}, @(G) {G}, @(G) step (G));
+  c(end+1) = bench_case ("bode", {}, @(G) {G, w}, @(G, w) bode (G, w));
+  c(end+1) = bench_case ("freqresp", {}, @(G) {G, w}, @(G, w) freqresp (G, w));
+  c(end+1) = bench_case ("c2d zoh", {"__sl_mb05nd__"},
+    @(G) {G}, @(G) c2d (G, 0.01));
+  c(end+1) = bench_case ("c2d tustin", {"__sl_ab04md__"},
+    @(G) {G}, @(G) c2d (G, 0.01, "tustin"));
+
+  ## Riccati and Lyapunov equations
+  c(end+1) = bench_case ("care", {"__sl_sb02od__"},
+    @(G) {G.a, G.b, eye (rows (G.a)), eye (columns (G.b))}, @care);
+  c(end+1) = bench_case ("care descriptor", {"__sl_sg02ad__"},
+    @(G) {G.a, G.b, eye (rows (G.a)), eye (columns (G.b)), [], bench_e (G)}, @care);
+  c(end+1) = bench_case ("dare", {"__sl_sb02od__"},
+    @(G) {bench_ad (G), G.b, eye (rows (G.a)), eye (columns (G.b))}, @dare);
+  c(end+1) = bench_case ("dlqr horizon", {"__sl_rde__"},
+    @(G) {bench_ad (G), G.b, eye (rows (G.a)), eye (columns (G.b))},
+    @(a, b, q, r) dlqr (a, b, q, r, "horizon", 100));
+  c(end+1) = bench_case ("lyap", {"__sl_sb03md__"},
+    @(G) {G.a, G.b*G.b.'}, @lyap);
+  c(end+1) = bench_case ("lyap sylvester", {"__sl_sb04md__"},
+    @(G) {G.a, G.a.', G.b*G.b.'}, @lyap);
+  c(end+1) = bench_case ("lyap descriptor", {"__sl_sg03ad__"},
+    @(G) {G.a, G.b*G.b.', [], bench_e (G)}, @lyap);
+  c(end+1) = bench_case ("lyapchol", {"__sl_sb03od__"}, @(G) {G.a, G.b}, @lyapchol);
+  c(end+1) = bench_case ("lyapchol descriptor", {"__sl_sg03bd__"},
+    @(G) {G.a, G.b, bench_e (G)}, @lyapchol);
+  c(end+1) = bench_case ("dlyap", {"__sl_sb03md__"},
+    @(G) {bench_ad (G), G.b*G.b.'}, @dlyap);
+  c(end+1) = bench_case ("dlyap sylvester", {"__sl_sb04qd__"},
+    @(G) {bench_ad (G), bench_ad (G).', G.b*G.b.'}, @dlyap);
+  c(end+1) = bench_case ("dlyap smith", {"__sl_smith__"},
+    @(G) {bench_ad (G), G.b*G.b.'}, @(a, q) dlyap (a, q, "method", "smith"));
+
+  ## norms, poles and zeros, transformations
+  c(end+1) = bench_case ("hsvd", {"__sl_ab13ad__"}, @(G) {G}, @hsvd);
+  c(end+1) = bench_case ("norm inf", {"__sl_ab13dd__"}, @(G) {G}, @(G) norm (G, Inf));
+  c(end+1) = bench_case ("norm 2", {"__sl_ab13bd__"}, @(G) {G}, @(G) norm (G, 2));
+  c(end+1) = bench_case ("zero", {"__sl_ab08nd__"}, @(G) {G}, @zero);
+  c(end+1) = bench_case ("minreal", {"__sl_tb01pd__"}, @(G) {G}, @minreal);
+  c(end+1) = bench_case ("prescale", {"__sl_tb01id__"}, @(G) {G}, @prescale);
+  c(end+1) = bench_case ("ctrbf", {"__sl_tb01ud__"}, @(G) {G}, @ctrbf);
+  c(end+1) = bench_case ("isctrb", {"__sl_ab01od__"}, @(G) {G}, @isctrb);
+  c(end+1) = bench_case ("place", {"__sl_sb01bd__"},
+    @(G) {G, -(1:rows (G.a))}, @place);
+  c(end+1) = bench_case ("ss2tf", {"__sl_tb04bd__"}, @(G) {G}, @tf);
+  c(end+1) = bench_case ("tf2ss", {"__sl_td04ad__"}, @(G) {tf (G)}, @ss);
+
+  ## descriptor systems
+  c(end+1) = bench_case ("dss2ss", {"__sl_tg01fd__", "__sl_sb10jd__"},
+    @(G) {bench_dss (G)}, @ssdata);
+  c(end+1) = bench_case ("dss minreal", {"__sl_tg01jd__"}, @(G) {bench_dss (G)}, @minreal);
+  c(end+1) = bench_case ("dss prescale", {"__sl_tg01ad__"}, @(G) {bench_dss (G)}, @prescale);
+  c(end+1) = bench_case ("dss isctrb", {"__sl_tg01hd__"}, @(G) {bench_dss (G)}, @isctrb);
+  c(end+1) = bench_case ("dss isobsv", {"__sl_tg01id__"}, @(G) {bench_dss (G)}, @isobsv);
+  c(end+1) = bench_case ("dss pole", {"__sl_ag08bd__"}, @(G) {bench_dss (G)}, @pole);
+  c(end+1) = bench_case ("dss zero", {"__sl_ag08bd__", "__sl_tg04bx__"},
+    @(G) {bench_dss (G)}, @zero);
+
+  ## model and controller reduction
+  c(end+1) = bench_case ("btamodred", {"__sl_ab09id__"},
+    @(G) {G, ceil (rows (G.a) / 2)}, @btamodred);
+  c(end+1) = bench_case ("spamodred", {"__sl_ab09id__"},
+    @(G) {G, ceil (rows (G.a) / 2)}, @spamodred);
+  c(end+1) = bench_case ("bstmodred", {"__sl_ab09hd__"},
+    @(G) {G, ceil (rows (G.a) / 2)}, @bstmodred);
+  c(end+1) = bench_case ("hnamodred", {"__sl_ab09jd__"},
+    @(G) {G, ceil (rows (G.a) / 2)}, @hnamodred);
+  c(end+1) = bench_case ("cfconred", {"__sl_sb16bd__"},
+    @(G) bench_gains (G), @cfconred);
+  c(end+1) = bench_case ("fwcfconred", {"__sl_sb16cd__"},
+    @(G) bench_gains (G), @fwcfconred);
+  c(end+1) = bench_case ("spaconred", {"__sl_sb16ad__"},
+    @(G) bench_controller (G), @spaconred);
+
+  ## synthesis
+  c(end+1) = bench_case ("hinfsyn", {"__sl_sb10fd__"}, @bench_plant, @hinfsyn);
+  c(end+1) = bench_case ("hinfsyn discrete", {"__sl_sb10dd__"},
+    @(G) bench_plant (c2d (G, 0.1)), @hinfsyn);
+  c(end+1) = bench_case ("h2syn", {"__sl_sb10hd__"}, @bench_plant, @h2syn);
+  c(end+1) = bench_case ("h2syn discrete", {"__sl_sb10ed__"},
+    @(G) bench_plant (c2d (G, 0.1)), @h2syn);
+  c(end+1) = bench_case ("ncfsyn", {"__sl_sb10id__"}, @(G) {G}, @ncfsyn);
+  c(end+1) = bench_case ("ncfsyn discrete", {"__sl_sb10zd__"},
+    @(G) {c2d (G, 0.1)}, @ncfsyn);
+  c(end+1) = bench_case ("fitfrd", {"__sl_sb10yd__"},
+    @(G) {frd (G(1,1), w), 4}, @fitfrd);
+
+  ## identification
+  c(end+1) = bench_case ("n4sid", {"__sl_ib01ad__", "__sl_ib01bd__", "__sl_ib01cd__"},
+    @(G) {bench_iddata (G), 4}, @n4sid);
+  c(end+1) = bench_case ("moesp", {"__sl_ib01ad__", "__sl_ib01bd__"},
+    @(G) {bench_iddata (G), 4}, @moesp);
+  c(end+1) = bench_case ("arx", {"__sl_arx__"},
+    @(G) {bench_iddata (G), "na", 4, "nb", 4}, @arx);
+  c(end+1) = bench_case ("preprocess", {"__sl_iddata_pipeline__"},
+    @(G) {bench_iddata (G), "detrend", 1, "filter", {[1, 0.5], [1, -0.8]}}, @preprocess);
+
+endfunction
+
+
+function c = bench_case (name, wrappers, setup, run)
+
+  c = struct ("name", name, "wrappers", {wrappers}, "setup", setup, "run", run);
+
+endfunction
+
+
+## discrete-time state matrix with spectral radius 0.9
+function a = bench_ad (G)
+
+  a = 0.9 * G.a / max (abs (eig (G.a)));
+
+endfunction
+
+
+function e = bench_e (G)
+
+  n = rows (G.a);
+  e = eye (n) + 0.01 * randn (n, n);
+
+endfunction
+
+
+function Gd = bench_dss (G)
+
+  Gd = dss (G.a, G.b, G.c, G.d, bench_e (G));
+
+endfunction
+
+
+## state feedback and observer gains for the coprime factor reductions
+function args = bench_gains (G)
+
+  [a, b, c] = ssdata (G);
+  F = -lqr (a, b, eye (rows (a)), eye (columns (b)));
+  L = -lqr (a.', c.', eye (rows (a)), eye (rows (c))).';
+  args = {G, F, L, ceil (rows (a) / 4)};
+
+endfunction
+
+
+## observer-based controller for the controller reduction
+function args = bench_controller (G)
+
+  g = bench_gains (G);
+  [F, L] = g{2:3};
+  [a, b, c] = ssdata (G);
+  K = ss (a + b*F + L*c, -L, F, 0);
+  args = {G, K, ceil (rows (a) / 4)};
+
+endfunction
+
+
+## mixed-sensitivity plant, the measurements are the outputs of G
+function args = bench_plant (G)
+
+  [p, m] = size (G);
+  tsam = get (G, "tsam");
+  W1 = bench_c2d (ss (-1e-2, 1, 1, 0.5), tsam) * eye (p);
+  W3 = bench_c2d (ss (-1e2, 1, 1e2, 1), tsam) * eye (p);
+  args = {augw (G, W1, [], W3), p, m};
+
+endfunction
+
+
+function dat = bench_iddata (G)
+
+  Gd = c2d (G, 0.1);
+  u = randn (2000, size (G, 2));
+  y = lsim (Gd, u) + 0.01 * randn (2000, size (G, 1));
+  dat = iddata (y, u, 0.1);
+
+endfunction
+
+
+function W = bench_c2d (W, tsam)
+
+  if (tsam > 0)
+    W = c2d (W, tsam);
+  endif
+
+endfunction
+
+
+function bench_write (file, res)
+
+  [~, ~, ext] = fileparts (file);
+
+  switch (lower (ext))
+    case ".json"
+      fid = fopen (file, "w");
+      fputs (fid, jsonencode (res));
+      fclose (fid);
+    case ".csv"
+      fid = fopen (file, "w");
+      fprintf (fid, "case,size,n,min,median,slicot,routines,error\n");
+      for r = res(:).'
+        fprintf (fid, "\"%s\",\"%s\",%d,%.6g,%.6g,%.6g,\"%s\",\"%s\"\n", r.case,
+                 r.size, r.n, r.min, r.median, r.slicot, r.routines,
+                 strrep (r.error, "\"", "'"));
+      endfor
+      fclose (fid);
+    otherwise
+      error ("bench_control: output file must be .json or .csv");
+  endswitch
+
+endfunction
+
+
+function base = bench_read (file)
+
+  [~, ~, ext] = fileparts (file);
+
+  switch (lower (ext))
+    case ".json"
+      base = jsondecode (fileread (file));
+    case ".csv"
+      lines = strsplit (strtrim (fileread (file)), "\n");
+      base = struct ("case", {}, "size", {}, "median", {});
+      for k = 2 : numel (lines)
+        f = strsplit (lines{k}, ",");     # commas only in the last field
+        base(end+1) = struct ("case", strrep (f{1}, "\"", ""),
+                              "size", strrep (f{2}, "\"", ""),
+                              "median", str2double (f{5}));
+      endfor
+    otherwise
+      error ("bench_control: baseline file must be .json or .csv");
+  endswitch
+
+endfunction
+
+
+function nreg = bench_compare (res, base, tolerance)
+
+  key = @(s) strcat ({s.case}, "@", {s.size});
+  [found, idx] = ismember (key (res), key (base));
+  for k = find (found)
+    found(k) = isnumeric (base(idx(k)).median) && isscalar (base(idx(k)).median)
+               && base(idx(k)).median > 0 && ! isnan (res(k).median);
+  endfor
+
+  printf ("\n%-24s %-14s %12s %12s %8s\n", "case", "size", "base [s]", "now [s]", "ratio");
+
+  nreg = 0;
+  for k = find (found)
+    ratio = res(k).median / base(idx(k)).median;
+    flag = "";
+    if (ratio > tolerance)
+      flag = "  regression";
+      nreg++;
+    endif
+    printf ("%-24s %-14s %12.4g %12.4g %8.2f%s\n", res(k).case, res(k).size,
+            base(idx(k)).median, res(k).median, ratio, flag);
+  endfor
+
+  printf ("\n%d of %d cases compared, %d regressions (tolerance %g)\n",
+          nnz (found), numel (res), nreg, tolerance);
+
+endfunction
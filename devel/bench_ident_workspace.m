@@ -0,0 +1,39 @@
+## Throughput of moesp for long datasets with different memory budgets
+## for the IB01AD/IB01BD workspace.  With the minimal workspace, the QR
+## algorithm (alg 'q') processes the block Hankel matrices in small row
+## blocks; larger budgets allow larger blocks.
+##
+## Usage:  run from the package directory after installation,
+##         bench_ident_workspace
+
+pkg load control
+
+sys = ss ([0.9, 0.2, 0; -0.2, 0.8, 0; 0, 0, 0.5], [1, 0; 0.5, 1; 1, 0.3],
+          [1, 0, 1; 0, 1, 0], 0, 1);
+
+nsmp = [1e4, 1e5, 1e6];
+budget = [1e-3, 1, 16, 256, 0];         # MiB, 0: no limit
+s = 15;
+alg = {"q", "c"};
+
+for a = 1 : numel (alg)
+  printf ("\nalg '%s'\n", alg{a});
+  printf ("%10s", "samples");
+  printf ("%12s", arrayfun (@(b) sprintf ("%g MiB", b), budget, "uniformoutput", false){:});
+  printf ("\n");
+
+  for k = 1 : numel (nsmp)
+    u = randn (nsmp(k), 2);
+    y = lsim (sys, u) + 0.01 * randn (nsmp(k), 2);
+    dat = iddata (y, u, 1);
+
+    printf ("%10d", nsmp(k));
+    for b = budget
+      tic;
+      moesp (dat, 3, "s", s, "alg", alg{a}, "workspace", b);
+      t = toc;
+      printf ("%12s", sprintf ("%.2f Ms/s", nsmp(k) / t / 1e6));
+    endfor
+    printf ("\n");
+  endfor
+endfor
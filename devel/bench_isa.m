@@ -0,0 +1,41 @@
+## Gain of the variants of the oct-files for instruction set extensions
+## over the baseline build on the care, lyap and H-infinity norm paths
+## (SB02OD, SB03MD, AB13DD).  The package must be built with ISA, e.g.
+##
+##   ISA="avx2 avx512" octave --eval 'pkg install control-x.y.z.tar.gz'
+##
+## Every variant which is installed and supported by the CPU runs the
+## cases of bench_control, the ratios are the median times relative to
+## the baseline, below 1 for a gain.  The options are passed to
+## bench_control, e.g.
+##
+##   bench_isa ("sizes", [100, 400], "repeat", 10)
+
+function bench_isa (varargin)
+
+  pkg load control
+
+  [~, avail] = __control_isa__ ();
+  if (numel (avail) == 1)
+    warning ("bench_isa: no variant for instruction set extensions installed");
+  endif
+
+  ## random systems only
+  opts = {"sizes", [50, 100, 200], "filter", "^(care|lyap|norm inf)$", "models"};
+  opts{end+1} = {};
+  opts = [opts, varargin];
+  base = [tempname(), ".json"];
+
+  unwind_protect
+    printf ("\nvariant baseline\n\n");
+    bench_control (opts{:}, "isa", "baseline", "output", base);
+
+    for k = 2 : numel (avail)
+      printf ("\nvariant %s\n\n", avail{k});
+      bench_control (opts{:}, "isa", avail{k}, "baseline", base);
+    endfor
+  unwind_protect_cleanup
+    unlink (base);
+  end_unwind_protect
+
+endfunction
@@ -30,7 +30,7 @@
 
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: July 2012
-## Version: 0.1
+## Version: 0.2
 
 function dat = nkshift (dat, nk = 0)
 
@@ -50,11 +50,11 @@ function dat = nkshift (dat, nk = 0)
 
   if (nargin == 2)      # default: shortening y and u by nk
     if (snk >= 0)
-      dat.y = cellfun (@(y) y(nk+1:end, :), dat.y, "uniformoutput", false);
-      dat.u = cellfun (@(u) u(1:end-nk, :), dat.u, "uniformoutput", false);
+      dat.y = cellfun (@(y) __iddata_view__ (y, nk+1:rows (y)), dat.y, "uniformoutput", false);
+      dat.u = cellfun (@(u) __iddata_view__ (u, 1:rows (u)-nk), dat.u, "uniformoutput", false);
     else
-      dat.y = cellfun (@(y) y(1:end-nk, :), dat.y, "uniformoutput", false);
-      dat.u = cellfun (@(u) u(nk+1:end, :), dat.u, "uniformoutput", false);
+      dat.y = cellfun (@(y) __iddata_view__ (y, 1:rows (y)-nk), dat.y, "uniformoutput", false);
+      dat.u = cellfun (@(u) __iddata_view__ (u, nk+1:rows (u)), dat.u, "uniformoutput", false);
     endif
   else                  # append: keep y, padding u with nk zeros
     [~, ~, m] = size (dat);
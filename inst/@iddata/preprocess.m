@@ -0,0 +1,229 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @deftypefn {Function File} {@var{dat} =} preprocess (@var{dat}, @var{'stage1'}, @var{arg1}, @var{'stage2'}, @var{arg2}, @dots{})
+## @deftypefnx {Function File} {@var{dat} =} preprocess (@dots{}, @var{'threads'}, @var{nthreads})
+## Apply a chain of preprocessing stages to the output and input signals
+## of dataset @var{dat} in one pass.
+## The stages are applied in the order of the arguments, a stage may occur
+## more than once.  The result equals the one of the corresponding chain of
+## @command{detrend}, @command{filter}, @command{resample} and @command{nkshift},
+## but every signal is read and written only once, no intermediate datasets
+## are created and the channels of all experiments are processed in parallel.
+##
+## @strong{Inputs}
+## @table @var
+## @item dat
+## iddata identification dataset containing signals in time-domain.
+## @end table
+##
+## @strong{Stages}
+## @table @var
+## @item 'detrend'
+## Remove the best fit of a polynomial of order @var{ord}.  The argument is
+## a non-negative integer or one of the strings @code{"constant"} and
+## @code{"linear"}.  See @command{detrend}.
+## @item 'filter'
+## Filter the signals.  The argument is either a cell @code{@{b, a@}},
+## a cell @code{@{b, a, si@}} with initial conditions @var{si} for every
+## channel, or a discrete-time SISO @acronym{LTI} system.
+## See @command{filter}.
+## @item 'resample'
+## Change the sample rate by a factor of @code{p/q}.  The argument is a
+## vector @code{[p, q]} or a cell @code{@{p, q, n@}} with the order @var{n}
+## or the impulse response of the anti-aliasing @acronym{FIR} filter.
+## Filter orders greater than zero require the signal package.
+## See @command{resample}.
+## @item 'nkshift'
+## Shorten output and input signals by @var{nk} samples such that the
+## inputs are delayed by @var{nk} samples.  See @command{nkshift}.
+## @end table
+##
+## @strong{Options}
+## @table @var
+## @item 'threads'
+## Number of threads.  By default, one thread per core is used.
+## @end table
+##
+## @strong{Outputs}
+## @table @var
+## @item dat
+## iddata identification dataset with preprocessed
+## output and input signals.
+## @end table
+##
+## @strong{Example}
+## @example
+## @group
+## dat = preprocess (dat, "detrend", "linear", "filter", @{b, a@}, ...
+##                        "resample", [1, 4], "nkshift", 2);
+## @end group
+## @end example
+##
+## @end deftypefn
+
+## Created: October 2026
+## Version: 0.1
+
+function dat = preprocess (dat, varargin)
+
+  if (nargin < 1 || rem (nargin, 2) != 1)
+    print_usage ();
+  endif
+
+  if (! dat.timedomain)
+    error ("iddata: preprocess: require iddata set in time-domain");
+  endif
+
+  stages = {};
+  nthreads = 0;
+  ratio = 1;
+
+  for k = 1 : 2 : numel (varargin)
+    stage = varargin{k};
+    val = varargin{k+1};
+
+    if (! ischar (stage))
+      error ("iddata: preprocess: stage names must be strings");
+    endif
+
+    switch (lower (stage))
+      case "detrend"
+        if (ischar (val))
+          switch (lower (val))
+            case "constant"
+              val = 0;
+            case "linear"
+              val = 1;
+            otherwise
+              error ("iddata: preprocess: detrend order must be 'constant' or 'linear'");
+          endswitch
+        elseif (! is_real_scalar (val) || fix (val) != val || val < 0)
+          error ("iddata: preprocess: detrend order must be a non-negative integer");
+        endif
+        stages{end+1} = struct ("type", "detrend", "ord", val);
+
+      case "filter"
+        si = [];
+        if (isa (val, "lti"))
+          if (! issiso (val))
+            error ("iddata: preprocess: filter must be a SISO LTI system");
+          endif
+          if (isct (val))
+            val = c2d (val, dat.tsam{1});
+          endif
+          [b, a] = filtdata (val, "vector");
+        elseif (iscell (val) && any (numel (val) == [2, 3]))
+          b = val{1};
+          a = val{2};
+          if (numel (val) == 3)
+            si = val{3};
+          endif
+        else
+          error ("iddata: preprocess: filter requires {b, a}, {b, a, si} or an LTI system");
+        endif
+        if (! is_real_vector (b) || ! is_real_vector (a) || a(1) == 0)
+          error ("iddata: preprocess: filter polynomials must be real vectors with a(1) != 0");
+        endif
+        if (! isempty (si) && (! is_real_vector (si)
+                               || numel (si) != max (numel (a), numel (b)) - 1))
+          error ("iddata: preprocess: filter initial conditions must be a vector of length max (length (a), length (b)) - 1");
+        endif
+        stages{end+1} = struct ("type", "filter", "b", b, "a", a, "si", si);
+
+      case "resample"
+        n = 0;
+        if (iscell (val) && any (numel (val) == [2, 3]))
+          if (numel (val) == 3)
+            n = val{3};
+          endif
+          val = [val{1:2}];
+        endif
+        if (! is_real_vector (val) || numel (val) != 2 || any (val <= 0) || any (fix (val) != val))
+          error ("iddata: preprocess: resample requires positive integers p and q");
+        endif
+        p = val(1);
+        q = val(2);
+        if (is_real_scalar (n))       # order of the anti-aliasing filter
+          if (n == 0)
+            h = 1;                    # fir1 (0, 1/q)
+          else
+            try
+              pkg load signal;
+            catch
+              error ("iddata: preprocess: please install signal package to proceed");
+            end_try_catch
+            h = fir1 (n, 1/q);
+          endif
+        elseif (is_real_vector (n))   # impulse response of the anti-aliasing filter
+          h = n;
+        else
+          error ("iddata: preprocess: resample filter invalid");
+        endif
+        g = gcd (p, q);
+        stages{end+1} = struct ("type", "resample", "p", p/g, "q", q/g, "h", h);
+        ratio *= q/p;
+
+      case "nkshift"
+        if (! is_real_scalar (val) || fix (val) != val)
+          error ("iddata: preprocess: nkshift requires a scalar integer");
+        endif
+        stages{end+1} = struct ("type", "nkshift", "nk", val);
+
+      case "threads"
+        if (! is_real_scalar (val) || fix (val) != val)
+          error ("iddata: preprocess: 'threads' must be an integer");
+        endif
+        nthreads = val;
+
+      otherwise
+        error ("iddata: preprocess: invalid stage '%s'", stage);
+    endswitch
+  endfor
+
+  [dat.y, dat.u] = __sl_iddata_pipeline__ (dat.y, dat.u, stages, nthreads);
+
+  if (ratio != 1)
+    idx = cellfun (@(tsam) issample (tsam, 1), dat.tsam);
+    dat.tsam(idx) = cellfun (@(tsam) tsam*ratio, dat.tsam(idx), "uniformoutput", false);
+  endif
+
+endfunction
+
+
+%!shared DAT, B, A
+%! DAT = iddata ({[(1:10).', sin(1:10).'], [(10:-1:1).', cos(1:10).']}, ...
+%!               {[(41:50).', (1:10).'.^2], [(61:70).', exp(-(1:10)).']}, 0.1);
+%! B = [1, 0.5];
+%! A = [1, -0.8];
+%!test
+%! P = preprocess (DAT, "detrend", "linear", "filter", {B, A}, "nkshift", 2);
+%! Q = nkshift (filter (detrend (DAT, "linear"), B, A), 2);
+%! assert (P.y, Q.y, 1e-10);
+%! assert (P.u, Q.u, 1e-10);
+%!test
+%! P = preprocess (DAT, "nkshift", -3, "detrend", 2, "threads", 1);
+%! Q = detrend (nkshift (DAT, -3), 2);
+%! assert (P.y, Q.y, 1e-10);
+%! assert (P.u, Q.u, 1e-10);
+%!test
+%! P = preprocess (DAT, "resample", [2, 4]);
+%! assert (P.y{1}, DAT.y{1}(1:2:end,:), 1e-10);
+%! assert (P.u{2}, DAT.u{2}(1:2:end,:), 1e-10);
+%! assert (P.tsam{1}, 0.2, 1e-10);
+%!error <invalid stage> preprocess (DAT, "smooth", 3);
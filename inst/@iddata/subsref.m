@@ -24,7 +24,7 @@
 
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: February 2012
-## Version: 0.3
+## Version: 0.4
 
 function a = subsref (a, s)
 
@@ -58,14 +58,16 @@ function dat = __dat_prune__ (dat, spl_idx = ":", out_idx = ":", in_idx = ":", e
   in_idx = __handle_idx__ (dat.inname, in_idx, "inname");
   exp_idx = __handle_idx__ (dat.expname, exp_idx, "expname");
 
+  ## experiments are shared, contiguous samples and channels are
+  ## selected by slices, see __iddata_view__
   dat.y = dat.y(exp_idx);
-  dat.y = cellfun (@(y) y(spl_idx, out_idx), dat.y, "uniformoutput", false);
+  dat.y = cellfun (@(y) __iddata_view__ (y, spl_idx, out_idx), dat.y, "uniformoutput", false);
   dat.outname = dat.outname(out_idx);
   dat.outunit = dat.outunit(out_idx);
 
   if (! isempty (dat.u))
     dat.u = dat.u(exp_idx);
-    dat.u = cellfun (@(u) u(spl_idx, in_idx), dat.u, "uniformoutput", false);
+    dat.u = cellfun (@(u) __iddata_view__ (u, spl_idx, in_idx), dat.u, "uniformoutput", false);
     dat.inname = dat.inname(in_idx);
     dat.inunit = dat.inunit(in_idx);
   endif
@@ -103,3 +105,20 @@ function idx = __str2idx__ (name, str, id)
   endswitch
 
 endfunction
+
+
+%!shared DAT
+%! DAT = iddata ({[(1:10).', (11:20).'], [(21:30).', (31:40).']}, ...
+%!               {[(41:50).', (51:60).', (61:70).'], [(71:80).', (81:90).', (91:100).']});
+%!test
+%! D = DAT(3:7, 2, [1, 3], 2);
+%! assert (D.y, {(33:37).'});
+%! assert (D.u, {[(73:77).', (93:97).']});
+%!test
+%! D = DAT([2, 5, 6], :, 2:3);
+%! assert (D.y{1}, [2, 12; 5, 15; 6, 16]);
+%! assert (D.u{2}, [82, 92; 85, 95; 86, 96]);
+%!test
+%! D = DAT(logical ([1, 1, 0, 0, 0, 0, 0, 0, 0, 1]), 1, 2);
+%! assert (D.y, {[1; 2; 10]; [21; 22; 30]});
+%! assert (D.u, {[51; 52; 60]; [81; 82; 90]});
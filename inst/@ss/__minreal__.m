@@ -23,7 +23,7 @@
 
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: October 2009
-## Version: 0.4
+## Version: 0.5
 
 function retsys = __minreal__ (sys, tol)
 
@@ -38,16 +38,14 @@ function retsys = __minreal__ (sys, tol)
     if (rows (a) == rows (sys.a))
       retsys = sys;
     else
-      retsys = ss (a, b, c, sys.d);
-      retsys.lti = sys.lti;           # retain i/o names and tsam
+      retsys = __ss_trusted__ (a, b, c, sys.d, [], sys.lti);   # retain i/o names and tsam
     endif
   else
     [a, e, b, c] = __sl_tg01jd__ (sys.a, sys.e, sys.b, sys.c, tol, sys.scaled, 0, 0);
     if (rows (a) == rows (sys.a))
       retsys = sys;
     else
-      retsys = dss (a, b, c, sys.d, e);
-      retsys.lti = sys.lti;           # retain i/o names and tsam
+      retsys = __ss_trusted__ (a, b, c, sys.d, e, sys.lti);    # retain i/o names and tsam
     endif
   endif
 
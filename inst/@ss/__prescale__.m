@@ -23,21 +23,20 @@
 
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: June 2011
-## Version: 0.1
+## Version: 0.2
 
 function [retsys, lscale, rscale] = __prescale__ (sys, optarg = 0.0)
 
   if (isempty (sys.e))
     [a, b, c, ~, scale] = __sl_tb01id__ (sys.a, sys.b, sys.c, optarg);
-    retsys = ss (a, b, c, sys.d);
+    retsys = __ss_trusted__ (a, b, c, sys.d, [], sys.lti);
     lscale = scale.^-1;
     rscale = scale;
   else
     [a, e, b, c, lscale, rscale] = __sl_tg01ad__ (sys.a, sys.e, sys.b, sys.c, optarg);
-    retsys = dss (a, b, c, sys.d, e);
+    retsys = __ss_trusted__ (a, b, c, sys.d, e, sys.lti);
   endif
-  
-  retsys.scaled = true;
-  retsys.lti = sys.lti;  # retain i/o names and tsam
+
+  retsys.scaled = true;  # i/o names and tsam retained by sys.lti
 
 endfunction
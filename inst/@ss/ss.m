@@ -171,7 +171,7 @@
 
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: September 2009
-## Version: 0.4
+## Version: 0.5
 
 function sys = ss (varargin)
 
@@ -179,7 +179,18 @@ function sys = ss (varargin)
   ## inferiorto ("frd");
   superiorto ("zpk", "tf", "double");
 
-  if (nargin == 1)                      # shortcut for lti objects
+  if (nargin == 0)                      # empty model, filled in by methods
+    sys = class (struct ("a", zeros (0, 0), "b", zeros (0, 0),
+                         "c", zeros (0, 0), "d", zeros (0, 0),
+                         "e", [],
+                         "stname", {cell(0, 1)},
+                         "scaled", false), "ss", lti (0, 0, 0));
+    return;
+  elseif (nargin == 2 && isstruct (varargin{1}) && isa (varargin{2}, "lti"))
+    ## trusted data without any checks, see __ss_trusted__
+    sys = class (varargin{1}, "ss", varargin{2});
+    return;
+  elseif (nargin == 1)                  # shortcut for lti objects
     if (isa (varargin{1}, "ss"))        # already in ss form  sys = ss (sssys)
       sys = varargin{1};
       return;
@@ -220,11 +231,6 @@ function sys = ss (varargin)
       [a, b, c, d] = varargin{mat_idx};
     case 5
       [a, b, c, d, tsam] = varargin{mat_idx};
-      if (isempty (tsam) && is_real_matrix (tsam))
-        tsam = -1;
-      elseif (! issample (tsam, -10))
-        error ("ss: invalid sampling time");
-      endif
     case 0
       ## nothing to do here, just prevent case 'otherwise'
     otherwise
@@ -236,8 +242,9 @@ function sys = ss (varargin)
     varargin = horzcat ({"lti"}, varargin);
   endif
 
-  [a, b, c, d, tsam] = __adjust_ss_data__ (a, b, c, d, tsam);
-  [p, m, n] = __ss_dim__ (a, b, c, d);  # determine number of outputs, inputs and states
+  ## complete the matrices, check them and the sampling time,
+  ## determine number of outputs, inputs and states
+  [a, b, c, d, tsam, p, m, n] = __ss_validate__ (a, b, c, d, tsam);
 
   stname = repmat ({""}, n, 1);         # cell with empty state names
 
@@ -24,7 +24,7 @@
 ## Special thanks to Vasile Sima and Andras Varga for their advice.
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: October 2009
-## Version: 0.8
+## Version: 0.9
 
 function [retsys, retlti] = __sys2ss__ (sys)
 
@@ -64,10 +64,10 @@ function [retsys, retlti] = __sys2ss__ (sys)
     a = blkdiag (a1, a2);
     b = vertcat (b1, b2);
     c = horzcat (c1, c2);
-    retsys = dss (a, b, c, [], e);
+    retsys = __ss_trusted__ (a, b, c, zeros (p, m), e, sys.lti);
   else                    # proper transfer function
     [a, b, c, d] = __proper_tf2ss__ (num, den, p, m);
-    retsys = ss (a, b, c, d);
+    retsys = __ss_trusted__ (a, b, c, d, [], sys.lti);
   endif
 
   retlti = sys.lti;       # preserve lti properties such as tsam
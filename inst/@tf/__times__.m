@@ -21,7 +21,7 @@
 
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: April 2014
-## Version: 0.1
+## Version: 0.2
 
 function sys = __times__ (sys1, sys2)
 
@@ -33,22 +33,18 @@ function sys = __times__ (sys1, sys2)
     sys2 = tf (sys2);
   endif
 
-  sys = tf ();
-  sys.lti = __lti_group__ (sys1.lti, sys2.lti, "times");
-  
-  sys.num = cellfun (@mtimes, sys1.num, sys2.num, "uniformoutput", false);
-  sys.den = cellfun (@mtimes, sys1.den, sys2.den, "uniformoutput", false);
+  num = cellfun (@mtimes, sys1.num, sys2.num, "uniformoutput", false);
+  den = cellfun (@mtimes, sys1.den, sys2.den, "uniformoutput", false);
 
   if (sys1.tfvar == sys2.tfvar)
-    sys.tfvar = sys1.tfvar;
+    tfvar = sys1.tfvar;
   elseif (sys1.tfvar == "x")
-    sys.tfvar = sys2.tfvar;
+    tfvar = sys2.tfvar;
   else
-    sys.tfvar = sys1.tfvar;
+    tfvar = sys1.tfvar;
   endif
 
-  if (sys1.inv || sys2.inv)
-    sys.inv = true;
-  endif
+  sys = __tf_trusted__ (num, den, __lti_group__ (sys1.lti, sys2.lti, "times"),
+                        tfvar, sys1.inv || sys2.inv);
 
 endfunction
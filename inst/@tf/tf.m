@@ -163,7 +163,7 @@
 
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: September 2009
-## Version: 0.4
+## Version: 0.5
 
 function sys = tf (varargin)
 
@@ -171,7 +171,15 @@ function sys = tf (varargin)
   ## inferiorto ("frd", "ss", "zpk");           # error if de-commented. bug in octave?
   superiorto ("double");
 
-  if (nargin == 1)
+  if (nargin == 0)                              # empty model, filled in by methods
+    sys = class (struct ("num", {cell(0, 0)}, "den", {cell(0, 0)},
+                         "tfvar", "x", "inv", false), "tf", lti (0, 0, 0));
+    return;
+  elseif (nargin == 2 && isstruct (varargin{1}) && isa (varargin{2}, "lti"))
+    ## trusted data without any checks, see __tf_trusted__
+    sys = class (varargin{1}, "tf", varargin{2});
+    return;
+  elseif (nargin == 1)
     if (isa (varargin{1}, "tf"))                # tf (tfsys)
       sys = varargin{1};
       return;
@@ -204,11 +212,6 @@ function sys = tf (varargin)
       tsam = 0;
     case 3
       [num, den, tsam] = varargin{mat_idx};
-      if (isempty (tsam) && is_real_matrix (tsam))
-        tsam = -1;
-      elseif (! issample (tsam, -10))
-        error ("tf: invalid sampling time");
-      endif
     case 0
       ## nothing to do here, just prevent case 'otherwise'
     otherwise
@@ -220,8 +223,17 @@ function sys = tf (varargin)
     varargin = horzcat ({"lti"}, varargin);
   endif
   
-  [num, den, tsam, tfvar] = __adjust_tf_data__ (num, den, tsam);
-  [p, m] = __tf_dim__ (num, den);              # determine number of outputs and inputs
+  ## complete and check the data and the sampling time,
+  ## determine number of outputs and inputs
+  [num, den, tsam, tfvar, p, m] = __tf_validate__ (num, den, tsam);
+
+  if (isempty (tfvar))                         # cells with objects
+    [num, den, tsam, tfvar] = __adjust_tf_data__ (num, den, tsam);
+    [p, m] = __tf_dim__ (num, den);
+  else                                         # checked real-valued vectors
+    num = cellfun (@tfpoly, num, "uniformoutput", false);
+    den = cellfun (@tfpoly, den, "uniformoutput", false);
+  endif
 
   tfdata = struct ("num", {num},
                    "den", {den},
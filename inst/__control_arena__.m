@@ -0,0 +1,61 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Workspace arena and workspace budget of the SLICOT wrappers, combined
+## over all oct-files.
+##
+##   info = __control_arena__ ()                held and peak bytes, cap, budget
+##   old = __control_arena__ ("cap", bytes)     memory kept between calls
+##   __control_arena__ ("release")              free the arenas
+##   old = __control_arena__ ("budget", bytes)  budget of optimal workspaces
+##
+## Held and peak bytes are summed over the oct-files, cap and budget
+## are set for all of them.
+
+## Created: October 2026
+## Version: 0.1
+
+function retval = __control_arena__ (varargin)
+
+  fam = __control_slicot_families__ ();
+
+  if (nargin == 0)
+    retval = feval (fam{1}, "arena");
+    for k = 2 : numel (fam)
+      info = feval (fam{k}, "arena");
+      retval.held += info.held;
+      retval.peak += info.peak;
+    endfor
+  else
+    ## the old value is the one of the first oct-file
+    for k = numel (fam) : -1 : 1
+      if (strcmp (varargin{1}, "release"))
+        feval (fam{k}, "arena", varargin{:});
+      else
+        retval = feval (fam{k}, "arena", varargin{:});
+      endif
+    endfor
+  endif
+
+endfunction
+
+
+%!test
+%! info = __control_arena__ ();
+%! assert (fieldnames (info), {"held"; "peak"; "cap"; "budget"});
+%! old = __control_arena__ ("cap", 2^20);
+%! assert (__control_arena__ ("cap", old), 2^20);
@@ -0,0 +1,94 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Batch evaluation of a SLICOT wrapper for many argument sets on a
+## pool of threads.
+##
+##   [out, info, iwarn] = __control_batch__ (fcn, items)
+##   [out, info, iwarn] = __control_batch__ (fcn, items, nthreads)
+##
+## fcn is the name of the wrapper, e.g. "__sl_sb03md__", items a cell
+## array of cell arrays with the arguments of the calls, or a struct array
+## whose fields in order are the arguments.  All argument sets are checked
+## before the first call, the calls run on at most nthreads threads, by
+## default one per core.  out is a cell array of the size of items with
+## the cell arrays of the outputs of every call, empty for calls with
+## nonzero INFO.  info and iwarn are INFO and IWARN of every call.
+## Unlike the wrappers themselves, failed calls raise no error.
+##
+## Wrappers with batch evaluation:  __sl_sb02od__, __sl_sb03md__,
+## __sl_ab13bd__ and __sl_ab13dd__.
+
+## Created: October 2026
+## Version: 0.2
+
+function [out, info, iwarn] = __control_batch__ (fcn, items, nthreads = 0)
+
+  if (is_function_handle (fcn))
+    fcn = func2str (fcn);
+  endif
+
+  if (isstruct (items))
+    items = arrayfun (@(s) struct2cell (s).', items, "uniformoutput", false);
+  endif
+
+  ## the oct-file which contains the wrapper, the stub of its family
+  ## points to the same variant, see __control_isa__
+  [~, fam] = fileparts (which (fcn));
+  fam = regexprep (fam, '_(avx2|avx512)__$', "__");
+
+  if (! any (strcmp (fam, __control_slicot_families__ ())))
+    error ("__control_batch__: '%s' is not a SLICOT wrapper", fcn);
+  endif
+
+  [out, info, iwarn] = feval (fam, "batch", fcn, items, nthreads);
+
+endfunction
+
+
+%!test
+%! A = {[-1, 2; 0, -3], [-2, 1; 1, -4], [-1, 0; 0, -1]};
+%! items = cellfun (@(a) {a, -eye(2), false}, A, "uniformoutput", false);
+%! [out, info] = __control_batch__ ("__sl_sb03md__", items, 2);
+%! assert (size (out), [1, 3]);
+%! assert (info, [0, 0, 0]);
+%! for k = 1 : 3
+%!   assert (out{k}{1}, lyap (A{k}, eye (2)), 1e-12);
+%! endfor
+
+%!test
+%! sys = {ss (-1, 1, 1, 0), ss ([-1, 1; 0, -2], [0; 1], [1, 0], 0)};
+%! items = struct ("a", {}, "b", {}, "c", {}, "d", {}, "discrete", {});
+%! for k = 1 : 2
+%!   [a, b, c, d] = ssdata (sys{k});
+%!   items(k) = struct ("a", a, "b", b, "c", c, "d", d, "discrete", false);
+%! endfor
+%! out = __control_batch__ (@__sl_ab13bd__, items);
+%! assert (out{1}{1}, norm (sys{1}, 2), 1e-12);
+%! assert (out{2}{1}, norm (sys{2}, 2), 1e-12);
+
+%!test
+%! [level, avail] = __control_isa__ ();
+%! unwind_protect
+%!   __control_isa__ (avail{end});
+%!   out = __control_batch__ ("__sl_sb03md__", {{-1, -1, false}});
+%!   assert (out{1}{1}, 0.5, 1e-12);
+%! unwind_protect_cleanup
+%!   __control_isa__ (level);
+%! end_unwind_protect
+
+%!error <dimensions> __control_batch__ ("__sl_ab13bd__", {{1, 1, [1, 1], 0, false}})
@@ -0,0 +1,63 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Number of threads of the BLAS library.
+##
+##   info = __control_blas__ ()        struct with backend and threads
+##   old = __control_blas__ (n)        set the number of threads to n
+##
+## The backend, "FlexiBLAS", "OpenBLAS", "MKL" or "BLIS", is detected at
+## run time, "unknown" if none of them is found.  For an unknown backend,
+## threads and old are 0 and setting has no effect.  Outer parallelism,
+## e.g. several Octave processes or parfor, should set one BLAS thread
+## and restore the old number afterwards:
+##
+##   old = __control_blas__ (1);
+##   ...
+##   __control_blas__ (max (old, 1));
+##
+## The threads of the oct-files, e.g. of __control_batch__ or the option
+## "threads" of moesp, moen4 and n4sid, set one BLAS thread themselves
+## while they run.
+
+## Created: October 2026
+## Version: 0.1
+
+function retval = __control_blas__ (nthreads)
+
+  ## the BLAS library is shared by all oct-files
+  fam = __control_slicot_families__ ();
+  fam = fam{1};
+
+  if (nargin == 0)
+    retval = feval (fam, "blas");
+  else
+    retval = feval (fam, "blas", nthreads);
+  endif
+
+endfunction
+
+
+%!test
+%! info = __control_blas__ ();
+%! assert (any (strcmp (info.backend, {"FlexiBLAS", "OpenBLAS", "MKL", "BLIS", "unknown"})));
+%! if (info.threads > 0)
+%!   assert (__control_blas__ (1), info.threads);
+%!   assert (__control_blas__ (info.threads), 1);
+%! endif
+
+%!error <positive> __control_blas__ (0)
@@ -0,0 +1,117 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Variants of the oct-files of the SLICOT wrappers for instruction set
+## extensions of x86-64, see ISA in src/Makefile.
+##
+##   [level, avail] = __control_isa__ ()   select the best variant
+##   [level, avail] = __control_isa__ (l)  select variant l
+##
+## level is the selected variant, "baseline", "avx2" or "avx512", avail the
+## variants which are installed and supported by the CPU, see
+## __control_cpu__.  The autoloads of the functions of all families are
+## pointed to the oct-files of the selected variant.  Functions which are
+## already loaded are cleared and loaded again from the new oct-file.
+## The best variant is selected when the package is loaded.  If the
+## autoloads of the oct-files are not registered, level is "baseline".
+
+## PKG_ADD: __control_isa__ ();
+
+## Created: October 2026
+## Version: 0.1
+
+function [level, avail] = __control_isa__ (level = "")
+
+  levels = {"baseline", "avx2", "avx512"};
+  cpu = __control_cpu__ ();
+  supported = [true, cpu.avx2, cpu.avx512];
+
+  ## autoloads of the SLICOT wrappers, their family and current variant
+  al = autoload ();
+  fcn = {al.function};
+  [odir, file] = cellfun (@fileparts, {al.file}, "uniformoutput", false);
+  tok = regexp (file, '^__control_slicot_([a-z]+)(_avx2|_avx512)?__$', "tokens", "once");
+  idx = find (! cellfun (@isempty, tok));
+
+  if (isempty (idx))
+    avail = levels(1);
+    if (! any (strcmp (level, {"", "baseline"})))
+      error ("__control_isa__: variant '%s' is not available", level);
+    endif
+    level = "baseline";
+    return;
+  endif
+
+  fcn = fcn(idx);
+  odir = odir(idx);
+  fam = cellfun (@(t) t{1}, tok(idx), "uniformoutput", false);
+  cur = {al(idx).file};
+
+  ## a variant must be built for every family
+  [ufam, ifam] = unique (fam);
+  installed = true (size (levels));
+  for k = 2 : numel (levels)
+    for j = 1 : numel (ufam)
+      variant = oct_file (odir{ifam(j)}, ufam{j}, levels{k});
+      installed(k) = installed(k) && exist (variant, "file") == 2;
+    endfor
+  endfor
+
+  avail = levels(supported & installed);
+
+  if (isempty (level))
+    level = avail{end};
+  elseif (! any (strcmp (level, avail)))
+    error ("__control_isa__: variant '%s' is not available", level);
+  endif
+
+  ## the functions of the families and their stubs, see control_state.cc
+  fcn = [fcn, strcat ("__control_slicot_", ufam(:).', "__")];
+  odir = [odir, odir(ifam(:).')];
+  fam = [fam, ufam(:).'];
+
+  for k = 1 : numel (fcn)
+    variant = oct_file (odir{k}, fam{k}, level);
+    if (k > numel (cur) || ! strcmp (cur{k}, variant))
+      autoload (fcn{k}, variant);
+      clear ("-f", fcn{k});
+    endif
+  endfor
+
+endfunction
+
+
+function file = oct_file (dir, fam, level)
+
+  if (strcmp (level, "baseline"))
+    file = fullfile (dir, sprintf ("__control_slicot_%s__.oct", fam));
+  else
+    file = fullfile (dir, sprintf ("__control_slicot_%s_%s__.oct", fam, level));
+  endif
+
+endfunction
+
+
+%!test
+%! [level, avail] = __control_isa__ ();
+%! assert (level, avail{end});
+%! assert (avail{1}, "baseline");
+%! assert (__control_isa__ ("baseline"), "baseline");
+%! assert (__control_isa__ (level), level);
+%! assert (care (-1, 1, 1, 1), sqrt (2) - 1, 1e-12);
+
+%!error <not available> __control_isa__ ("sse")
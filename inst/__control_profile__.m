@@ -0,0 +1,82 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Profiling of the SLICOT calls, combined over all oct-files.
+##
+##   tab = __control_profile__ ()          struct array, one element per routine
+##   old = __control_profile__ ("on")      enable profiling
+##   old = __control_profile__ ("off")     disable profiling
+##   __control_profile__ ("reset")         clear the tables
+##
+## The fields of tab are routine, calls, time and maxtime in seconds, the
+## largest dimensions n, m, p and workspace in bytes, the number of calls
+## with nonzero INFO (errors) and IWARN (warnings), and the last nonzero INFO.
+## A routine called by several oct-files has one element with the counts
+## of all of them.
+
+## Created: October 2026
+## Version: 0.1
+
+function retval = __control_profile__ (varargin)
+
+  fam = __control_slicot_families__ ();
+
+  if (nargin == 0)
+    tab = cellfun (@(f) feval (f, "profile"), fam, "uniformoutput", false);
+    tab = vertcat (tab{:});
+    [routine, ~, idx] = unique ({tab.routine}.');
+    retval = tab(1:0);
+    for k = 1 : numel (routine)
+      t = tab(idx == k);
+      r = t(1);
+      r.calls = sum ([t.calls]);
+      r.time = sum ([t.time]);
+      r.errors = sum ([t.errors]);
+      r.warnings = sum ([t.warnings]);
+      for f = {"maxtime", "n", "m", "p", "workspace"}
+        r.(f{1}) = max ([t.(f{1})]);
+      endfor
+      info = [t.info];
+      if (any (info))
+        r.info = info(find (info, 1, "last"));
+      endif
+      retval(k,1) = r;
+    endfor
+  else
+    ## the old value is the one of the first oct-file
+    for k = numel (fam) : -1 : 1
+      if (strcmp (varargin{1}, "reset"))
+        feval (fam{k}, "profile", varargin{:});
+      else
+        retval = feval (fam{k}, "profile", varargin{:});
+      endif
+    endfor
+  endif
+
+endfunction
+
+
+%!test
+%! old = __control_profile__ ("on");
+%! __control_profile__ ("reset");
+%! lyap ([-1, 2; 0, -3], eye (2));
+%! tab = __control_profile__ ();
+%! assert (__control_profile__ ("off"), true);
+%! if (old)
+%!   __control_profile__ ("on");
+%! endif
+%! assert (any (strcmp ({tab.routine}, "SB03MD")));
@@ -0,0 +1,31 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Stub functions of the oct-files of the SLICOT wrappers.  Each oct-file
+## has its own workspace arena, workspace budget and profiling table,
+## accessed by calling its stub function, see src/control_state.cc.
+
+## Created: October 2026
+## Version: 0.1
+
+function fam = __control_slicot_families__ ()
+
+  fam = {"__control_slicot_riccati__", "__control_slicot_modred__", ...
+         "__control_slicot_ident__", "__control_slicot_synthesis__", ...
+         "__control_slicot_realization__"};
+
+endfunction
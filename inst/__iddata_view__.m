@@ -0,0 +1,67 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Select samples spl_idx and channels ch_idx of the signal matrix x of an
+## experiment.  Contiguous indices are passed on as colons or ranges such
+## that Octave returns slices which share the data of x instead of copies.
+## This is the case for x(:,j:k) and, for single channels, for x(i:j).
+## Other selections are copied.
+
+## Created: October 2026
+## Version: 0.1
+
+function x = __iddata_view__ (x, spl_idx = ":", ch_idx = ":")
+
+  [n, c] = size (x);
+  spl_idx = __contiguous_idx__ (spl_idx, n);
+  ch_idx = __contiguous_idx__ (ch_idx, c);
+
+  if (! ischar (ch_idx))
+    x = x(:, ch_idx);
+  endif
+
+  if (! ischar (spl_idx))
+    if (columns (x) == 1 && ! isempty (spl_idx))
+      x = x(spl_idx);
+    else
+      x = x(spl_idx, :);
+    endif
+  endif
+
+endfunction
+
+
+## replace contiguous index vectors by ranges and full ranges by colons
+function idx = __contiguous_idx__ (idx, n)
+
+  if (islogical (idx))
+    idx = find (idx);
+  endif
+
+  if (ischar (idx) || isempty (idx) || ! isvector (idx))
+    return;
+  endif
+
+  if (all (diff (idx(:)) == 1))
+    if (idx(1) == 1 && idx(end) == n)
+      idx = ":";
+    else
+      idx = idx(1) : idx(end);
+    endif
+  endif
+
+endfunction
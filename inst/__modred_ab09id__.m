@@ -79,6 +79,10 @@ function [Gr, info] = __modred_ab09id__ (method, varargin)
   equil = 0;
   ordsel = 1;
   nr = 0;
+  lowrank = false;
+  adi_tol = 1e-10;
+  adi_maxiter = 100;
+  band = interval = [];
 
   ## handle keys and values
   for k = 1 : 2 : nkv
@@ -109,6 +113,8 @@ function [Gr, info] = __modred_ab09id__ (method, varargin)
             bf = false;
           case "bfsr"
             bf = true;
+          case {"lr", "lowrank"}
+            lowrank = true;
           otherwise
             error ("modred: '%s' is an invalid approach", val);
         endswitch
@@ -128,6 +134,21 @@ function [Gr, info] = __modred_ab09id__ (method, varargin)
       case {"equil", "equilibrate", "equilibration", "scale", "scaling"}
         scaled = __modred_check_equil__ (val);
 
+      case "adi-tol"
+        adi_tol = __modred_check_tol__ (val, "adi-tol");
+
+      case "adi-maxiter"
+        if (! is_real_scalar (val) || val < 1 || fix (val) != val)
+          error ("%smodred: argument adi-maxiter must be a positive integer", method);
+        endif
+        adi_maxiter = val;
+
+      case {"frequency-band", "band"}
+        band = __modred_check_interval__ (val, "frequency-band");
+
+      case {"time-interval", "interval"}
+        interval = __modred_check_interval__ (val, "time-interval");
+
       otherwise
         warning ("%smodred: invalid property name '%s' ignored\n", method, key);
     endswitch
@@ -158,12 +179,31 @@ function [Gr, info] = __modred_ab09id__ (method, varargin)
   endif
   
   
+  limited = ! isempty (band) || ! isempty (interval);
+
+  if (limited && (weight != 0 || lowrank))
+    error ("%smodred: frequency- and time-limited methods support neither weightings nor the low-rank method", method);
+  elseif (! isempty (band) && ! isempty (interval))
+    error ("%smodred: options 'frequency-band' and 'time-interval' are mutually exclusive", method);
+  endif
+
   ## perform model order reduction
-  [ar, br, cr, dr, nr, hsv, ns] = __sl_ab09id__ (a, b, c, d, dt, equil, nr, ordsel, alpha, job, ...
-                                                 av, bv, cv, dv, ...
-                                                 aw, bw, cw, dw, ...
-                                                 weight, jobc, jobo, alphac, alphao, ...
-                                                 tol1, tol2);
+  if (limited)
+    [ar, br, cr, dr, nr, hsv, ns] = __modred_lgbt__ (a, b, c, d, dt, tsam, band, interval, ...
+                                                     nr, ordsel, job, tol1);
+  elseif (lowrank)
+    if (weight != 0)
+      error ("%smodred: frequency weightings are not supported by the low-rank method", method);
+    endif
+    [ar, br, cr, dr, nr, hsv, ns] = __modred_lrbt__ (a, b, c, d, dt, nr, ordsel, job, ...
+                                                     tol1, adi_tol, adi_maxiter);
+  else
+    [ar, br, cr, dr, nr, hsv, ns] = __sl_ab09id__ (a, b, c, d, dt, equil, nr, ordsel, alpha, job, ...
+                                                   av, bv, cv, dv, ...
+                                                   aw, bw, cw, dw, ...
+                                                   weight, jobc, jobo, alphac, alphao, ...
+                                                   tol1, tol2);
+  endif
 
   ## assemble reduced order model
   Gr = ss (ar, br, cr, dr, tsam);
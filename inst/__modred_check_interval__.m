@@ -0,0 +1,33 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## check frequency band or time interval for model reduction commands
+
+## Created: October 2026
+## Version: 0.1
+
+function val = __modred_check_interval__ (val, str = "")
+
+  if (! isreal (val) || ! isvector (val) || numel (val) != 2
+      || any (isnan (val)) || val(1) < 0 || val(1) >= val(2) || isinf (val(1)))
+    error ("modred: argument %s must be a real vector [lo, hi] with 0 <= lo < hi <= Inf", str);
+  endif
+
+  val = val(:).';
+
+endfunction
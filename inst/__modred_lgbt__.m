@@ -0,0 +1,146 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @deftypefn{Function File} {[@var{ar}, @var{br}, @var{cr}, @var{dr}, @var{nr}, @var{hsv}, @var{ns}] =} __modred_lgbt__ (@var{a}, @var{b}, @var{c}, @var{d}, @var{dt}, @var{tsam}, @var{band}, @var{interval}, @var{nr}, @var{ordsel}, @var{job}, @var{tol1})
+## Frequency- and time-limited balanced truncation for btamodred and spamodred.
+##
+## The limited Gramians solve Lyapunov equations with the usual
+## coefficient @var{a} and a modified right-hand side:
+##
+## @example
+## A P + P A' + S B B' + B B' S' = 0          (frequency band)
+## A P + P A' + E1 B B' E1' - E2 B B' E2' = 0 (time interval)
+## @end example
+##
+## with S = (S(w2) - S(w1)), S(w) = imag (logm (j*w*I - A)) / pi and
+## Ei = expm (A*ti) for continuous-time systems, and the analogous
+## expressions for discrete-time systems.  All computations are done
+## in the coordinates of the real Schur form of @var{a}, which is
+## computed once and reused by the matrix functions and by both
+## Lyapunov solves (SLICOT SB03MD with FACT = 'F').
+## @end deftypefn
+
+## Created: October 2026
+## Version: 0.1
+
+function [ar, br, cr, dr, nr, hsv, ns] = __modred_lgbt__ (a, b, c, d, dt, tsam, band, interval, nr, ordsel, job, tol1)
+
+  n = rows (a);
+  ns = n;
+
+  if (n == 0)
+    ar = a; br = b; cr = c; dr = d;
+    nr = 0;
+    hsv = zeros (0, 1);
+    return;
+  endif
+
+  if (dt && tsam <= 0)                      # unspecified sampling time
+    tsam = 1;
+  endif
+
+  ## real Schur form  a = u*t*u',  shared by all subsequent steps
+  [u, t] = schur (a, "real");
+  bt = u.' * b;
+  ct = c * u;
+  ## a finite time interval needs no stability, the Gramians exist anyway
+  if ((! isempty (band) || isinf (interval(2))) && ! __is_stable__ (eig (t), ! dt))
+    error ("modred: frequency- and time-limited methods require a stable system unless the time interval is finite");
+  endif
+
+  bb = bt * bt.';
+  cc = ct.' * ct;
+
+  if (! isempty (band))
+    s = __lgbt_freq__ (t, band(2), dt, tsam) - __lgbt_freq__ (t, band(1), dt, tsam);
+    rc = s * bb + bb * s.';
+    ro = s.' * cc + cc * s;
+  else
+    e1 = __lgbt_time__ (t, interval(1), dt, tsam);
+    e2 = __lgbt_time__ (t, interval(2), dt, tsam);
+    rc = e1 * bb * e1.' - e2 * bb * e2.';
+    ro = e1.' * cc * e1 - e2.' * cc * e2;
+  endif
+
+  ## t is already in real Schur form, the identity is its Schur factor
+  in = eye (n);
+  [p, scale] = __sl_sb03md__ (t, -rc, dt, in, 0);   # T P + P T' = -Rc
+  p /= scale;
+  [q, scale] = __sl_sb03md__ (t, -ro, dt, in, 1);   # T'Q + Q T  = -Ro
+  q /= scale;
+
+  zc = __lgbt_factor__ (p);
+  zo = __lgbt_factor__ (q);
+
+  [ar, br, cr, dr, nr, hsv] = __modred_sqrtbt__ (t, bt, ct, d, dt, zc, zo, ...
+                                                nr, ordsel, job, tol1);
+
+endfunction
+
+
+## S(w) for the frequency-limited Gramians, S(0) = 0 and S(Inf) = I/2
+function s = __lgbt_freq__ (t, w, dt, tsam)
+
+  n = rows (t);
+
+  if (dt)
+    theta = min (w * tsam, pi);             # normalized frequency
+    if (theta == 0)
+      s = zeros (n);
+    elseif (theta == pi)
+      s = eye (n) / 2;
+    else
+      s = theta/(2*pi) * eye (n) - imag (logm (eye (n) - t * exp (1i*theta))) / pi;
+    endif
+  else
+    if (w == 0)
+      s = zeros (n);
+    elseif (isinf (w))
+      s = eye (n) / 2;
+    else
+      s = imag (logm (1i*w*eye (n) - t)) / pi;
+    endif
+  endif
+
+endfunction
+
+
+## state transition over the time tau, zero for tau = Inf
+function e = __lgbt_time__ (t, tau, dt, tsam)
+
+  n = rows (t);
+
+  if (isinf (tau))
+    e = zeros (n);
+  elseif (dt)
+    e = t ^ round (tau / tsam);
+  else
+    e = expm (t * tau);
+  endif
+
+endfunction
+
+
+## factor z with z*z' = x of a symmetric positive semidefinite Gramian
+function z = __lgbt_factor__ (x)
+
+  [v, e] = eig ((x + x.') / 2);
+  e = max (diag (e), 0);
+  z = v .* sqrt (e).';
+
+endfunction
@@ -0,0 +1,226 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @deftypefn{Function File} {[@var{ar}, @var{br}, @var{cr}, @var{dr}, @var{nr}, @var{hsv}, @var{ns}] =} __modred_lrbt__ (@var{a}, @var{b}, @var{c}, @var{d}, @var{dt}, @var{nr}, @var{ordsel}, @var{job}, @var{tol1}, @var{adi_tol}, @var{adi_maxiter})
+## Low-rank backend for btamodred and spamodred.
+##
+## The Gramians are never formed.  Low-rank factors Zc, Zo with
+## P = Zc*Zc' and Q = Zo*Zo' are computed by the low-rank ADI iteration
+## with real shifts from Ritz values of @var{a}.  Discrete-time systems
+## are handled by the Cayley transformation, which preserves the
+## Gramians, such that only shifted solves with @var{a} are needed.
+## The reduced model is obtained from the factors by __modred_sqrtbt__.
+## @end deftypefn
+
+## Created: October 2026
+## Version: 0.2
+
+function [ar, br, cr, dr, nr, hsv, ns] = __modred_lrbt__ (a, b, c, d, dt, nr, ordsel, job, tol1, adi_tol, adi_maxiter)
+
+  n = rows (a);
+  ns = n;
+
+  if (n == 0)
+    ar = a; br = b; cr = c; dr = d;
+    nr = 0;
+    hsv = zeros (0, 1);
+    return;
+  endif
+
+  ## shifts from Ritz values, mapped to the continuous-time domain
+  lambda = __lrbt_ritz__ (a);
+
+  if (dt)
+    if (any (abs (lambda) >= 1))
+      error ("modred: low-rank method requires a stable system");
+    endif
+    lambda = (lambda - 1) ./ (lambda + 1);
+  elseif (any (real (lambda) >= 0))
+    error ("modred: low-rank method requires a stable system");
+  endif
+
+  shifts = __lrbt_shifts__ (lambda);
+
+  ## low-rank Gramian factors, P = zc*zc', Q = zo*zo'
+  zc = __lrbt_adi__ (a, b, dt, shifts, adi_tol, adi_maxiter);
+  zo = __lrbt_adi__ (a.', c.', dt, shifts, adi_tol, adi_maxiter);
+
+  [ar, br, cr, dr, nr, hsv] = __modred_sqrtbt__ (a, b, c, d, dt, zc, zo, ...
+                                                nr, ordsel, job, tol1);
+
+endfunction
+
+
+## Ritz values of a, exact eigenvalues for small models
+function lambda = __lrbt_ritz__ (a)
+
+  n = rows (a);
+
+  if (n <= 200)
+    lambda = eig (full (a));
+    return;
+  endif
+
+  k = min (20, n - 2);
+  opts.disp = 0;
+
+  try
+    lambda = [eigs(a, k, "lm", opts); eigs(a, k, "sm", opts)];
+  catch
+    lambda = eig (full (a));
+  end_try_catch
+
+endfunction
+
+
+## real ADI shifts by Penzl's heuristic on the candidate set -abs(lambda)
+function p = __lrbt_shifts__ (lambda, nshift = 12)
+
+  cand = unique (-abs (lambda));
+  cand = cand(cand < 0);
+
+  if (numel (cand) <= nshift)
+    p = cand;
+    return;
+  endif
+
+  rho = @(p) max (abs (prod ((p(:) - lambda(:).') ./ (p(:) + lambda(:).'), 1)));
+
+  p = [];
+  for k = 1 : nshift
+    val = arrayfun (@(x) rho ([p; x]), cand);
+    [~, idx] = min (val);
+    p = [p; cand(idx)];
+    cand(idx) = [];
+  endfor
+
+endfunction
+
+
+## low-rank ADI iteration for  a*x + x*a' + b*b' = 0  (continuous-time)
+## or  a*x*a' - x + b*b' = 0  (discrete-time, via Cayley transformation)
+function z = __lrbt_adi__ (a, b, dt, p, tol, maxiter)
+
+  n = rows (a);
+
+  if (issparse (a))
+    in = speye (n);
+  else
+    in = eye (n);
+  endif
+
+  if (dt)
+    ## ac = (a-I)/(a+I),  bc = sqrt(2)*inv(a+I)*b
+    ## inv(ac + p*I)*w = (a+I) * inv((1+p)*a + (p-1)*I) * w
+    w = sqrt (2) * ((a + in) \ b);
+  else
+    w = b;
+  endif
+
+  nb = norm (w.' * w);
+  np = numel (p);
+  m = columns (w);
+
+  ## the shifts are used cyclically, every shifted matrix is factorized once
+  fact = cell (np, 1);
+
+  ## the factor is z(:,1:nz), with room for the 20 steps between compressions
+  z = zeros (n, 20*m);
+  nz = 0;
+
+  for k = 1 : maxiter
+    j = mod (k-1, np) + 1;
+    pk = p(j);
+
+    if (isempty (fact{j}))
+      if (dt)
+        fact{j} = __lrbt_lu__ ((1 + pk) * a + (pk - 1) * in);
+      else
+        fact{j} = __lrbt_lu__ (a + pk * in);
+      endif
+    endif
+
+    v = __lrbt_solve__ (fact{j}, w);
+    if (dt)
+      v = (a + in) * v;
+    endif
+
+    w -= 2 * pk * v;
+    z(:, nz+1:nz+m) = sqrt (-2 * pk) * v;
+    nz += m;
+
+    if (nb == 0 || norm (w.' * w) <= tol * nb)
+      break;
+    endif
+
+    if (rem (k, 20) == 0)
+      zk = __lrbt_compress__ (z(:, 1:nz));
+      nz = columns (zk);
+      z = [zk, zeros(n, 20*m)];
+    endif
+  endfor
+
+  z = z(:, 1:nz);
+
+  if (nb > 0 && norm (w.' * w) > tol * nb)
+    warning ("modred: low-rank ADI did not reach tolerance %g in %d steps\n", tol, maxiter);
+  endif
+
+  z = __lrbt_compress__ (z);
+
+endfunction
+
+
+## LU factorization of a shifted matrix, and the solve with it
+function f = __lrbt_lu__ (m)
+
+  if (issparse (m))
+    [f.l, f.u, f.p, f.q] = lu (m);
+  else
+    [f.l, f.u, f.p] = lu (m);
+    f.q = [];
+  endif
+
+endfunction
+
+
+function v = __lrbt_solve__ (f, w)
+
+  v = f.u \ (f.l \ (f.p * w));
+
+  if (! isempty (f.q))
+    v = f.q * v;
+  endif
+
+endfunction
+
+
+## column compression of a low-rank factor, z*z' is preserved
+function z = __lrbt_compress__ (z)
+
+  if (isempty (z))
+    return;
+  endif
+
+  [q, r] = qr (z, 0);
+  [u, s, ~] = svd (r, "econ");
+  s = diag (s);
+  r = sum (s > max (size (z)) * eps * s(1));
+  z = q * (u(:,1:r) .* s(1:r).');
+
+endfunction
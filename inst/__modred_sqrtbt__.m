@@ -0,0 +1,144 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @deftypefn{Function File} {[@var{ar}, @var{br}, @var{cr}, @var{dr}, @var{nr}, @var{hsv}] =} __modred_sqrtbt__ (@var{a}, @var{b}, @var{c}, @var{d}, @var{dt}, @var{zc}, @var{zo}, @var{nr}, @var{ordsel}, @var{job}, @var{tol1})
+## Square-root balancing from given Gramian factors P = zc*zc' and
+## Q = zo*zo'.  Backend of the low-rank and the frequency- or
+## time-limited model reduction in btamodred and spamodred.
+##
+## The Hankel singular values are the singular values of zo'*zc.  If the
+## order @var{nr} is given (@var{ordsel} = 0) and the factors have many
+## columns, only the leading singular triplets are computed by a
+## randomized SVD.
+##
+## @var{job} as in __sl_ab09id__:  0 square-root BTA, 1 balancing-free
+## square-root BTA, 2 and 3 SPA of the balanced realization of the
+## numerically minimal part.
+## @end deftypefn
+
+## Created: October 2026
+## Version: 0.1
+
+function [ar, br, cr, dr, nr, hsv] = __modred_sqrtbt__ (a, b, c, d, dt, zc, zo, nr, ordsel, job, tol1)
+
+  n = rows (a);
+
+  if (ordsel == 0)
+    k = min (nr + 10, min (columns (zo), columns (zc)));
+    [u, hsv, v] = __sqrtbt_rsvd__ (zo, zc, k);
+  else
+    [u, s, v] = svd (zo.' * zc, "econ");
+    hsv = diag (s);
+  endif
+
+  if (isempty (hsv))
+    hsv = zeros (0, 1);
+    nmin = 0;
+  else
+    ## states belonging to zero Hankel singular values are uncontrollable
+    ## or unobservable and cannot be balanced
+    nmin = sum (hsv > n * eps * max (hsv(1), 1));
+  endif
+
+  ## order selection
+  if (ordsel != 0)
+    if (tol1 <= 0 && ! isempty (hsv))
+      tol1 = n * eps * hsv(1);
+    endif
+    nr = sum (hsv > tol1);
+  endif
+
+  nr = min (nr, nmin);
+
+  switch (job)
+    case 0                                  # square-root BT
+      [tl, tr] = __sqrtbt_proj__ (zo, zc, u, hsv, v, nr);
+      ar = tl.' * a * tr;
+      br = tl.' * b;
+      cr = c * tr;
+      dr = d;
+
+    case 1                                  # balancing-free square-root BT
+      x = orth (zc * v(:,1:nr));
+      y = orth (zo * u(:,1:nr));
+      e = y.' * x;
+      ar = e \ (y.' * a * x);
+      br = e \ (y.' * b);
+      cr = c * x;
+      dr = d;
+
+    otherwise                               # SPA of the balanced realization
+      [tl, tr] = __sqrtbt_proj__ (zo, zc, u, hsv, v, nmin);
+      ab = tl.' * a * tr;
+      bb = tl.' * b;
+      cb = c * tr;
+      i1 = 1 : nr;
+      i2 = nr+1 : nmin;
+      if (dt)
+        e22 = eye (numel (i2)) - ab(i2,i2);
+      else
+        e22 = -ab(i2,i2);
+      endif
+      ar = ab(i1,i1) + ab(i1,i2) * (e22 \ ab(i2,i1));
+      br = bb(i1,:) + ab(i1,i2) * (e22 \ bb(i2,:));
+      cr = cb(:,i1) + cb(:,i2) * (e22 \ ab(i2,i1));
+      dr = d + cb(:,i2) * (e22 \ bb(i2,:));
+  endswitch
+
+endfunction
+
+
+## square-root balancing projections  tl'*tr = I
+function [tl, tr] = __sqrtbt_proj__ (zo, zc, u, hsv, v, r)
+
+  sinv = 1 ./ sqrt (hsv(1:r));
+  tr = zc * v(:,1:r) .* sinv.';
+  tl = zo * u(:,1:r) .* sinv.';
+
+endfunction
+
+
+## randomized SVD of zo'*zc with k leading singular triplets
+function [u, s, v] = __sqrtbt_rsvd__ (zo, zc, k)
+
+  kc = columns (zc);
+
+  if (2*k >= min (columns (zo), kc))
+    [u, s, v] = svd (zo.' * zc, "econ");
+    s = diag (s);
+    return;
+  endif
+
+  ## reproducible sketch without disturbing the state of the generator
+  state = randn ("state");
+  unwind_protect
+    randn ("state", 42);
+    omega = randn (kc, k);
+  unwind_protect_cleanup
+    randn ("state", state);
+  end_unwind_protect
+
+  y = zo.' * (zc * omega);
+  y = zo.' * (zc * (zc.' * (zo * y)));      # one power iteration
+  q = orth (y);
+
+  [ub, s, v] = svd ((q.' * zo.') * zc, "econ");
+  u = q * ub;
+  s = diag (s);
+
+endfunction
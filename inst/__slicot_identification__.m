@@ -38,12 +38,18 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
       error ("ident: invalid method");  # should never happen
   endswitch
 
-  if (! isa (dat, "iddata") || ! dat.timedomain)
-    error ("%s: first argument must be a time-domain 'iddata' dataset", method);
+  ## data stream:  function handle returning chunks, or binary file
+  stream = is_function_handle (dat) || isstruct (dat);
+
+  ## no data, only the stored factor of an earlier identification
+  nodata = isnumeric (dat) && isempty (dat);
+
+  if (! stream && ! nodata && (! isa (dat, "iddata") || ! dat.timedomain))
+    error ("%s: first argument must be a time-domain 'iddata' dataset or a data stream", method);
   endif
   
   if (nargin > 3)                       # ident (dat, ...)
-    if (is_real_scalar (varargin{1}))   # ident (dat, n, ...)
+    if (is_real_vector (varargin{1}))   # ident (dat, n, ...)
       varargin = horzcat (varargin(2:end), {"order"}, varargin(1));
     endif
     if (isstruct (varargin{1}))         # ident (dat, opt, ...), ident (dat, n, opt, ...)
@@ -57,18 +63,32 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
     error ("%s: keys and values must come in pairs", method);
   endif
 
-  [ns, p, m, e] = size (dat);           # dataset dimensions
-  tsam = dat.tsam;
-  
-  ## multi-experiment data requires equal sampling times  
-  if (e > 1 && ! isequal (tsam{:}))
-    error ("%s: require equally sampled experiments", method);
+  y0 = u0 = [];                         # first chunk of a data stream
+
+  if (stream && isstruct (dat) && numel (dat) != 1)
+    error ("%s: data streams from files require a single experiment", method);
+  endif
+
+  if (stream || nodata)
+    tsam = -1;                          # unless given by key "tsam"
+    if (isstruct (dat) && isfield (dat, "tsam"))
+      tsam = dat.tsam;                  # iddataread (file, "map")
+    endif
   else
-    tsam = tsam{1};
+    [ns, p, m, e] = size (dat);         # dataset dimensions
+    tsam = dat.tsam;
+
+    ## multi-experiment data requires equal sampling times
+    if (e > 1 && ! isequal (tsam{:}))
+      error ("%s: require equally sampled experiments", method);
+    else
+      tsam = tsam{1};
+    endif
   endif
   
   ## default arguments
   alg = 0;
+  alg_key = false;                      # algorithm chosen by the user
   conct = 1;                            # no connection between experiments
   ctrl = 1;                             # don't confirm order n
   rcond = 0.0;
@@ -77,6 +97,12 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
   n = [];
   conf = [];
   noise = "n";
+  chunk = 65536;                        # samples per chunk of a data file
+  threads = [];                         # serial IB01AD, parallel IB01BD
+  factor = [];                          # stored triangular factor
+  workspace = 256;                      # memory budget in MiB for optional workspace
+  window = [];                          # samples of a recursive identification
+  update = false;                       # add new samples to a stored factor
   
   ## handle keys and values
   for k = 1 : 2 : nkv
@@ -84,10 +110,10 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
     val = varargin{k+1};
     switch (key)
       case {"n", "order"}
-        if (! issample (val, 0) || val != round (val))
-          error ("%s: 'n' must be a positive integer", method);
+        if (! is_real_vector (val) || ! all (val > 0 & val == round (val) & isfinite (val)))
+          error ("%s: 'n' must be a positive integer or a vector of positive integers", method);
         endif
-        n = val;
+        n = val(:).';
       case "s"
         if (! issample (val, 0) || val != round (val))
           error ("%s: 's' must be a positive integer", method);
@@ -103,6 +129,7 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
         else
           error ("%s: invalid algorithm", method);
         endif
+        alg_key = true;
       case "tol"
         if (! is_real_scalar (val))
           error ("%s: tolerance 'tol' must be a real scalar", method);
@@ -117,29 +144,120 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
         conf = logical (val);
       case {"noiseinput", "noiseinputs", "noise", "input", "inputs"}
         noise = val;
+      case "tsam"
+        if (! stream)
+          warning ("%s: key 'tsam' is only used for data streams\n", method);
+        elseif (! issample (val, -1))
+          error ("%s: invalid sampling time 'tsam'", method);
+        endif
+        tsam = val;
+      case "threads"
+        if (! is_real_scalar (val) || val < 0 || val != round (val))
+          error ("%s: 'threads' must be a non-negative integer", method);
+        endif
+        threads = val;
+      case "factor"
+        if (! isstruct (val) || ! isfield (val, "r") || ! isfield (val, "nobr"))
+          error ("%s: 'factor' must be the field 'info.factor' of an earlier identification", method);
+        endif
+        factor = val;
+      case "workspace"
+        if (! is_real_scalar (val) || val < 0)
+          error ("%s: 'workspace' must be a non-negative real scalar", method);
+        endif
+        workspace = val;
+      case "window"
+        if (! is_real_scalar (val) || val < 1 || (isfinite (val) && val != round (val)))
+          error ("%s: 'window' must be a positive integer or Inf", method);
+        endif
+        window = val;
+      case "update"
+        update = logical (val);
+      case "chunk"
+        if (! issample (val, 1) || val != round (val))
+          error ("%s: 'chunk' must be a positive integer", method);
+        endif
+        chunk = val;
       otherwise
         warning ("%s: invalid property name '%s' ignored\n", method, key);
     endswitch
   endfor
   
 
+  if (nodata && isempty (factor))
+    error ("%s: first argument must be a time-domain 'iddata' dataset or a data stream", method);
+  endif
+
+  ## recursive identification, the raw factor is updated with new samples
+  if (update && (isempty (factor) || ! isfield (factor, "r0")))
+    error ("%s: 'update' requires the 'factor' of a recursive identification with key 'window'", method);
+  endif
+  if (update && isempty (window))
+    window = factor.window;
+  endif
+  recursive = ! isempty (window);
+  if (recursive && (stream || nodata || e > 1))
+    error ("%s: recursive identification requires a single-experiment 'iddata' dataset", method);
+  endif
+  if (recursive && ! isempty (factor) && ! update)
+    error ("%s: use key 'update' to add the samples of the dataset to the stored factor", method);
+  endif
+
   ## handle s/nobr and n
-  nsmp = sum (ns);                      # total number of samples
-  nobr = fix ((nsmp+1)/(2*(m+p+1)));
-  if (e > 1)
-    nobr = min (nobr, fix (min (ns) / 2));
+  if (! isempty (factor))
+    ## the factor determines s, the data are not compressed again
+    if (stream)
+      error ("%s: a stored factor cannot be combined with a data stream", method);
+    endif
+    if ((factor.meth == 0) != (meth == 0))
+      error ("%s: the stored factor belongs to another method", method);
+    endif
+    if (! isempty (s) && s != factor.nobr)
+      error ("%s: the stored factor was computed for s = %d", method, factor.nobr);
+    endif
+    s = nobr = factor.nobr;
+    if (isempty (n))
+      n = 0;                            # use the order estimate
+    endif
+    if (any (n >= nobr))
+      error ("%s: n=%d, but require n < %d (s)", method, max (n), nobr);
+    endif
+    if (nodata)
+      p = factor.p;
+      m = factor.m;
+      tsam = factor.tsam;
+    elseif (p != factor.p || m != factor.m)
+      error ("%s: the stored factor belongs to a %dx%d system", method, factor.p, factor.m);
+    endif
+  elseif (stream)
+    ## the length of a stream is not known in advance
+    if (isempty (s) && isempty (n))
+      error ("%s: data streams require the order 'n' or the upper bound 's'", method);
+    endif
+    nobr = Inf;
+  else
+    nsmp = sum (ns);                    # total number of samples
+    if (recursive)
+      nsmp = min (nsmp, window);        # samples in the window
+    endif
+    nobr = fix ((nsmp+1)/(2*(m+p+1)));
+    if (e > 1)
+      nobr = min (nobr, fix (min (ns) / 2));
+    endif
   endif
 
-  if (nobr < 1)
+  if (isempty (factor) && nobr < 1)
     error ("%s: for the given system dimensions (%dx%d), the iddata dataset does not contain enough samples per experiment", ...
            method, p, m);
   endif
   
-  if (isempty (s) && isempty (n))
+  if (! isempty (factor))
+    ## s and n checked above
+  elseif (isempty (s) && isempty (n))
     ctrl = 0;                           # confirm system order estimate
     n = 0;
   elseif (isempty (s))
-    s = min (2*n, n+10);                # upper bound for n
+    s = min (2*max (n), max (n)+10);    # upper bound for n
     nobr = min (nobr, s);
   elseif (isempty (n))
     nobr = __check_s__ (s, nobr, method);
@@ -147,8 +265,8 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
     n = 0;
   else                                  # s & n non-empty
     nobr = __check_s__ (s, nobr, method);
-    if (n >= nobr)
-      error ("%s: n=%d, but require n < %d (s)", method, n, nobr);
+    if (any (n >= nobr))
+      error ("%s: n=%d, but require n < %d (s)", method, max (n), nobr);
     endif
   endif
 
@@ -156,9 +274,57 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
     ctrl = ! conf;
   endif
 
+  ## workspace beyond the minimum, for larger blocks in the QR factorizations
+  budget = workspace * 2^20;            # bytes, 0: no limit
+
+  ## several orders from a single decomposition of the data
+  sweep = numel (n) > 1;
+  ## parallel compression by TSQR, a variant of the QR algorithm
+  tsqr = ! isempty (threads) && threads != 1 ...
+         && ! (update || recursive || stream || ! isempty (factor));
+
+  if (tsqr && alg_key && alg != 2)
+    error ("%s: 'threads' other than 1 uses the QR algorithm, 'alg' must be 'qr'", method);
+  endif
+
+  if (update)
+    ## new samples, then remove the samples which leave the window
+    st = __ident_update__ (factor, dat.y{1}, dat.u{1}, window, nobr, meth, ctrl, rcond, tol);
+  elseif (recursive)
+    ## initial factor from the last samples within the window
+    y = dat.y{1}(max (1, end-window+1):end, :);
+    u = dat.u{1}(max (1, end-window+1):end, :);
+    st = struct ("r0", [], "y", zeros (0, p), "u", zeros (0, m), "nsmpl", 0);
+    st = __ident_update__ (st, y, u, window, nobr, meth, ctrl, rcond, tol);
+  elseif (! isempty (factor))
+    st = factor;
+  elseif (stream)
+    ## compress the data chunk by chunk, R is carried in the state st
+    st = struct ("nobr", nobr, "meth", meth, "alg", alg, "ctrl", ctrl,
+                 "rcond", rcond, "tol", tol, "budget", budget);
+    [st, y0, u0] = __ident_stream__ (st, dat, chunk, method);
+    p = st.l;
+    m = st.m;
+  elseif (tsqr)
+    ## parallel TSQR of the experiments, then SVD and order estimate
+    [r, sv, nrec, nsmpl] = __sl_ident_tsqr__ (dat.y, dat.u, nobr, meth, ctrl, rcond, tol, threads, 1024);
+    st = struct ("r", r, "sv", sv, "n", nrec, "nsmpl", nsmpl);
+  elseif (sweep && nout > 0)
+    ## IB01AD only, IB01BD follows for every order
+    [sv, nrec, r, nsmpl] = __sl_ib01ad__ (dat.y, dat.u, nobr, 0, meth, alg, conct, ctrl, rcond, tol, budget);
+    st = struct ("r", r, "sv", sv, "n", nrec, "nsmpl", nsmpl);
+  endif
+
+  compressed = ! isempty (factor) || recursive || stream || tsqr || (sweep && nout > 0);  # R available in st
+
   if (nout == 0)
     ## compute singular values
-    [sv, nrec] = __sl_ib01ad__ (dat.y, dat.u, nobr, n, meth, alg, conct, ctrl, rcond, tol);
+    if (compressed)
+      sv = st.sv;
+      nrec = st.n;
+    else
+      [sv, nrec] = __sl_ib01ad__ (dat.y, dat.u, nobr, 0, meth, alg, conct, ctrl, rcond, tol, budget);
+    endif
 
     ## there is no 'logbar' function
     svl = log10 (sv);
@@ -175,51 +341,63 @@ function [sys, x0, info] = __slicot_identification__ (method, nout, dat, varargi
     grid on
   else
     ## perform system identification
-    [a, b, c, d, q, ry, s, k, x0] = __sl_ident__ (dat.y, dat.u, nobr, n, meth, alg, conct, ctrl, rcond, tol);
-
-    ## compute noise variance matrix factor L
-    ## L L' = Ry,  e = L v
-    ## v becomes white noise with identity covariance matrix
-    l = chol (ry, "lower");
-
-    ## assemble model
-    [inname, outname] = get (dat, "inname", "outname");
-    if (strncmpi (noise, "e", 1))         # add error inputs e, not normalized
-      sys = ss (a, [b, k], c, [d, eye(p)], tsam);
-      in_u = __labels__ (inname, "u");
-      in_e = __labels__ (outname, "y");
-      in_e = cellfun (@(x) ["e@", x], in_e, "uniformoutput", false);
-      inname = [in_u; in_e];
-    elseif (strncmpi (noise, "v", 1))     # add error inputs v, normalized
-      sys = ss (a, [b, k*l], c, [d, l], tsam);
-      in_u = __labels__ (inname, "u");
-      in_v = __labels__ (outname, "y");
-      in_v = cellfun (@(x) ["v@", x], in_v, "uniformoutput", false);
-      inname = [in_u; in_v];
-    elseif (strncmpi (noise, "k", 1))     # Kalman predictor
-      sys = ss ([a-k*c], [b-k*d, k], c, [d, zeros(p)], tsam);
-      in_u = __labels__ (inname, "u");
-      in_y = __labels__ (outname, "y");
-      inname = [in_u; in_y];
-    else                                  # no error inputs, default
-      sys = ss (a, b, c, d, tsam);
-    endif
-
-    sys = set (sys, "inname", inname, "outname", outname);
-
-    ## return x0 as vector for single-experiment data
-    ## instead of a cell containing one vector
-    if (numel (x0) == 1)
-      x0 = x0{1};
-    endif
-
-    ## assemble info struct
-    ## Kalman gain matrix K
-    ## state covariance matrix Q
-    ## output covariance matrix Ry
-    ## state-output cross-covariance matrix S
-    ## noise variance matrix factor L
-    info = struct ("K", k, "Q", q, "Ry", ry, "S", s, "L", l);
+    if (sweep)
+      ## IB01BD for all orders in parallel threads, cell arrays of results
+      if (isempty (threads))
+        threads = 0;                    # one thread per core
+      endif
+      [a, b, c, d, q, ry, s, k] = __sl_ib01bd_sweep__ (st.r, nobr, n, m, p, st.nsmpl, meth, rcond, threads, budget);
+    elseif (compressed)
+      if (n == 0)
+        n = st.n;                       # order estimate of IB01AD
+      endif
+      [a, b, c, d, q, ry, s, k] = __sl_ib01bd__ (st.r, nobr, n, m, p, st.nsmpl, meth, rcond, budget);
+    else
+      [a, b, c, d, q, ry, s, k, x0, r, sv, nsmpl, nrec] = __sl_ident__ (dat.y, dat.u, nobr, n, meth, alg, conct, ctrl, rcond, tol, budget);
+      st = struct ("r", r, "sv", sv, "n", nrec, "nsmpl", nsmpl);
+    endif
+
+    ## input and output names
+    if (nodata)
+      inname = factor.inname;
+      outname = factor.outname;
+    elseif (stream)
+      inname = repmat ({""}, m, 1);
+      outname = repmat ({""}, p, 1);
+    else
+      [inname, outname] = get (dat, "inname", "outname");
+    endif
+
+    ## triangular factor R of the data for further identifications
+    ## with other orders, IB01BD and IB01CD only
+    factor = struct ("meth", meth, "nobr", nobr, "p", p, "m", m, "tsam", tsam,
+                     "inname", {inname}, "outname", {outname},
+                     "r", st.r, "sv", st.sv, "n", st.n, "nsmpl", st.nsmpl);
+
+    if (recursive)
+      ## raw factor and the samples needed for the next update
+      factor.r0 = st.r0;
+      factor.y = st.y;
+      factor.u = st.u;
+      factor.window = window;
+    endif
+
+    if (sweep)
+      ## cell arrays of models and initial states, struct array info
+      no = numel (n);
+      sys = x0 = cell (1, no);
+      for i = 1 : no
+        x0i = __ident_x0__ (dat, stream, nodata, y0, u0, a{i}, b{i}, c{i}, d{i}, rcond);
+        [sys{i}, x0{i}, info(i)] = __ident_model__ (a{i}, b{i}, c{i}, d{i}, q{i}, ry{i}, s{i}, k{i}, x0i,
+                                                    tsam, noise, inname, outname, factor);
+      endfor
+    else
+      if (compressed)
+        x0 = __ident_x0__ (dat, stream, nodata, y0, u0, a, b, c, d, rcond);
+      endif
+      [sys, x0, info] = __ident_model__ (a, b, c, d, q, ry, s, k, x0,
+                                         tsam, noise, inname, outname, factor);
+    endif
   endif
 
 endfunction
@@ -234,3 +412,203 @@ function nobr = __check_s__ (s, nobr, method)
   endif
 
 endfunction
+
+
+## initial state by IB01CD
+function x0 = __ident_x0__ (dat, stream, nodata, y0, u0, a, b, c, d, rcond)
+
+  if (stream)
+    x0 = __sl_ib01cd__ ({y0}, {u0}, a, b, c, d, rcond);   # x0 from the first chunk
+  elseif (nodata)
+    x0 = [];                            # no data, no initial state
+  else
+    x0 = __sl_ib01cd__ (dat.y, dat.u, a, b, c, d, rcond);
+  endif
+
+endfunction
+
+
+## assemble the model with the requested noise inputs and the info struct
+function [sys, x0, info] = __ident_model__ (a, b, c, d, q, ry, s, k, x0, tsam, noise, inname, outname, factor)
+
+  p = rows (c);
+
+  ## compute noise variance matrix factor L
+  ## L L' = Ry,  e = L v
+  ## v becomes white noise with identity covariance matrix
+  l = chol (ry, "lower");
+
+  ## assemble model
+  if (strncmpi (noise, "e", 1))         # add error inputs e, not normalized
+    sys = ss (a, [b, k], c, [d, eye(p)], tsam);
+    in_u = __labels__ (inname, "u");
+    in_e = __labels__ (outname, "y");
+    in_e = cellfun (@(x) ["e@", x], in_e, "uniformoutput", false);
+    inname = [in_u; in_e];
+  elseif (strncmpi (noise, "v", 1))     # add error inputs v, normalized
+    sys = ss (a, [b, k*l], c, [d, l], tsam);
+    in_u = __labels__ (inname, "u");
+    in_v = __labels__ (outname, "y");
+    in_v = cellfun (@(x) ["v@", x], in_v, "uniformoutput", false);
+    inname = [in_u; in_v];
+  elseif (strncmpi (noise, "k", 1))     # Kalman predictor
+    sys = ss ([a-k*c], [b-k*d, k], c, [d, zeros(p)], tsam);
+    in_u = __labels__ (inname, "u");
+    in_y = __labels__ (outname, "y");
+    inname = [in_u; in_y];
+  else                                  # no error inputs, default
+    sys = ss (a, b, c, d, tsam);
+  endif
+
+  sys = set (sys, "inname", inname, "outname", outname);
+
+  ## return x0 as vector for single-experiment data
+  ## instead of a cell containing one vector
+  if (numel (x0) == 1)
+    x0 = x0{1};
+  endif
+
+  ## assemble info struct
+  ## Kalman gain matrix K
+  ## state covariance matrix Q
+  ## output covariance matrix Ry
+  ## state-output cross-covariance matrix S
+  ## noise variance matrix factor L
+  ## triangular factor of the data for reuse
+  info = struct ("K", k, "Q", q, "Ry", ry, "S", s, "L", l, "factor", factor);
+
+endfunction
+
+
+## add the samples y, u to the raw factor of a recursive identification
+## and remove the samples which leave the window
+function st = __ident_update__ (st, y, u, window, nobr, meth, ctrl, rcond, tol)
+
+  ov = 2*nobr - 1;                      # samples shared by consecutive Hankel rows
+  nold = rows (st.y);
+
+  ## Hankel rows of the new samples, continued from the stored ones
+  yadd = [st.y(max (1, nold-ov+1):end, :); y];
+  uadd = [st.u(max (1, nold-ov+1):end, :); u];
+
+  if (isfinite (window))
+    yw = [st.y; y];
+    uw = [st.u; u];
+    nd = max (0, rows (yw) - window);   # samples leaving the window
+    ydel = yw(1:min (nd+ov, end), :);
+    udel = uw(1:min (nd+ov, end), :);
+    if (nd == 0)
+      ydel = ydel(1:0, :);
+      udel = udel(1:0, :);
+    endif
+    yw = yw(nd+1:end, :);
+    uw = uw(nd+1:end, :);
+    if (nd >= nold)
+      st.r0 = [];                       # the window is replaced, start again
+    endif
+    nsmpl = rows (yw);
+  else
+    ## growing window, only the overlap is kept
+    ydel = yadd(1:0, :);
+    udel = uadd(1:0, :);
+    if (isempty (st.r0))
+      yw = y;
+      uw = u;
+    else
+      yw = y(1:0, :);
+      uw = u(1:0, :);
+    endif
+    nsmpl = st.nsmpl + rows (y);
+  endif
+
+  [r0, r, sv, n] = __sl_ident_update__ (st.r0, yadd, uadd, ydel, udel, yw, uw,
+                                        nsmpl, nobr, meth, ctrl, rcond, tol);
+
+  if (isfinite (window))
+    st.y = yw;
+    st.u = uw;
+  else
+    st.y = yadd(max (1, end-ov+1):end, :);
+    st.u = uadd(max (1, end-ov+1):end, :);
+  endif
+
+  st.r0 = r0;
+  st.r = r;
+  st.sv = sv;
+  st.n = n;
+  st.nsmpl = nsmpl;
+
+endfunction
+
+
+## feed a data stream to IB01AD, return the state and the first chunk
+function [st, y0, u0] = __ident_stream__ (st, src, chunk, method)
+
+  nobr = st.nobr;
+
+  if (isstruct (src))
+    ## binary file of float64 (or float32) values, the columns of y
+    ## followed by the columns of u, each of length nsmp, starting at
+    ## byte offset
+    if (! isfield (src, "file") || ! isfield (src, "nsmp")
+        || ! isfield (src, "outputs") || ! isfield (src, "inputs"))
+      error ("%s: data file struct requires fields 'file', 'nsmp', 'outputs' and 'inputs'", method);
+    endif
+    if (! isfield (src, "offset"))
+      src.offset = 0;
+    endif
+    if (! isfield (src, "precision"))
+      src.precision = "double";
+    endif
+    bytes = 8 - 4 * strcmp (src.precision, "single");
+    src.chunk = chunk;
+
+    st = __sl_ident_stream__ (st, src);
+
+    ## first chunk for the initial state
+    n0 = min (max (chunk, 2*nobr), src.nsmp);
+    nch = src.outputs + src.inputs;
+    [fid, msg] = fopen (src.file, "rb");
+    if (fid < 0)
+      error ("%s: %s", method, msg);
+    endif
+    unwind_protect
+      z = zeros (n0, nch);
+      for j = 1 : nch
+        fseek (fid, src.offset + bytes*(j-1)*src.nsmp, SEEK_SET);
+        z(:,j) = fread (fid, n0, [src.precision, "=>double"]);
+      endfor
+    unwind_protect_cleanup
+      fclose (fid);
+    end_unwind_protect
+    y0 = z(:, 1:src.outputs);
+    u0 = z(:, src.outputs+1:end);
+  else
+    ## [y, u] = src (k) returns the k-th chunk, empty y after the last one
+    [y, u] = src (1);
+    if (isempty (y))
+      error ("%s: the data stream is empty", method);
+    endif
+    y0 = y;
+    u0 = u;
+    k = 1;
+
+    while (true)
+      k++;
+      [yn, un] = src (k);
+      if (isempty (yn))
+        st = __sl_ident_stream__ (st, y, u, true);
+        break;
+      elseif (rows (y) < 2*nobr || rows (yn) < 2*nobr)
+        ## IB01AD requires 2*nobr samples per chunk
+        y = [y; yn];
+        u = [u; un];
+      else
+        st = __sl_ident_stream__ (st, y, u, false);
+        y = yn;
+        u = un;
+      endif
+    endwhile
+  endif
+
+endfunction
@@ -0,0 +1,56 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Create a state-space model from data which is known to be consistent,
+## e.g. the results of methods of the ss class, without the checks of the
+## ss constructor.  e is [] for non-descriptor models.  ltisys is either
+## the sampling time or an lti object with the i/o names, which must have
+## rows (d) outputs and columns (d) inputs.  The states are unnamed unless
+## stname is given.
+
+## Created: October 2026
+## Version: 0.1
+
+function sys = __ss_trusted__ (a, b, c, d, e = [], ltisys = 0, stname = [])
+
+  if (! isa (ltisys, "lti"))
+    [p, m] = size (d);
+    ltisys = lti (p, m, ltisys);
+  endif
+
+  if (isempty (e))
+    e = [];                             # avoid [](nx0) or [](0xn)
+  endif
+
+  if (isempty (stname))
+    stname = repmat ({""}, rows (a), 1);
+  endif
+
+  sys = ss (struct ("a", a, "b", b,
+                    "c", c, "d", d,
+                    "e", e,
+                    "stname", {stname},
+                    "scaled", false), ltisys);
+
+endfunction
+
+
+%!test
+%! a = [-1, 2; 0, -3];  b = [1; 1];  c = [1, 0];  d = 0;
+%! sys = __ss_trusted__ (a, b, c, d, [], 0.1);
+%! assert (isequal (sys, ss (a, b, c, d, 0.1)));
+
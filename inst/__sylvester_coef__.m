@@ -0,0 +1,53 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## Check a coefficient of a Sylvester equation.  @var{a} is either a
+## real square matrix or a struct with fields @var{u} and @var{t} holding
+## its real Schur factorization @code{a = u*t*u'}, e.g. from
+## @code{[s.u, s.t] = schur (a)}.  Return the matrix or Schur factor
+## @var{t}, the orthogonal factor @var{u} and whether @var{a} is factored.
+
+## Created: October 2026
+## Version: 0.1
+
+function [t, u, fact] = __sylvester_coef__ (a, name, caller)
+
+  if (isstruct (a))
+    if (! isscalar (a) || ! all (isfield (a, {"u", "t"})))
+      error ("%s: factored coefficient %s must be a struct with fields 'u' and 't'", ...
+             caller, name);
+    endif
+    t = a.t;
+    u = a.u;
+    if (! is_real_square_matrix (t, u) || ! size_equal (t, u))
+      error ("%s: %s.u and %s.t must be real square matrices of equal size", ...
+             caller, name, name);
+    endif
+    if (any (tril (t, -2)(:)))
+      error ("%s: %s.t must be in real Schur form", caller, name);
+    endif
+    fact = true;
+  elseif (is_real_square_matrix (a))
+    t = a;
+    u = [];
+    fact = false;
+  else
+    error ("%s: %s must be real and square", caller, name);
+  endif
+
+endfunction
@@ -0,0 +1,50 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## Create a transfer function model from data which is known to be
+## consistent, without the checks of the tf constructor.  num and den are
+## cells of tfpoly objects of equal size.  ltisys is either the sampling
+## time or an lti object with the i/o names.  tfvar is "s", "z" or "x"
+## for static gains.
+
+## Created: October 2026
+## Version: 0.1
+
+function sys = __tf_trusted__ (num, den, ltisys = 0, tfvar = "s", inv = false)
+
+  if (! isa (ltisys, "lti"))
+    [p, m] = size (num);
+    ltisys = lti (p, m, ltisys);
+  endif
+
+  sys = tf (struct ("num", {num}, "den", {den},
+                    "tfvar", tfvar, "inv", inv), ltisys);
+
+endfunction
+
+
+%!test
+%! num = {tfpoly([1, 2])};  den = {tfpoly([1, 3, 2])};
+%! sys = __tf_trusted__ (num, den, 0, "s");
+%! assert (isequal (sys, tf ([1, 2], [1, 3, 2])));
+
+%!test
+%! ## cells with objects take the checks of the M-files in tf
+%! sys = tf ({tfpoly([1, 1])}, {tfpoly([1, 2])});
+%! assert (isequal (sys, tf ([1, 1], [1, 2])));
+%! sys = tf ({tfpoly([1, 1]), 2}, {tfpoly([1, 2]), [1, 3]}, 0.1);
+%! assert (isequal (sys, tf ({[1, 1], 2}, {[1, 2], [1, 3]}, 0.1)));
@@ -38,8 +38,13 @@
 ## @table @var
 ## @item dat
 ## iddata identification dataset containing the measurements, i.e. time-domain signals.
+## Alternatively, the experiments of a binary iddata file as returned by
+## @code{iddataread (file, "map")}.  The file is memory-mapped and the
+## signals are not read into Octave unless @var{x0} is requested.
 ## @item n
 ## The desired order of the resulting model @var{sys}.
+## A row vector of orders estimates one model per order,
+## see 'Several Structures' below.
 ## @item @dots{}
 ## Optional pairs of keys and values.  @code{'key1', value1, 'key2', value2}.
 ## @item opt
@@ -79,9 +84,23 @@
 ## @end table
 ##
 ##
+## @strong{Several Structures}@*
+## If @var{na} is a row vector with more than one element, or @var{nk}
+## is a row vector, one model is estimated for every structure
+## @code{[na(k), nb(k), nk(k)]}.  The orders apply to all channels,
+## scalars are used for all structures.  The data are processed only
+## once for all structures, and @var{sys} and @var{x0} become cell
+## vectors with one element per structure.  Order scans, e.g.
+## @code{arx (dat, 1:20)}, are therefore hardly more expensive than the
+## estimation of the largest model.
+##
+##
 ## @strong{Algorithm}@*
 ## Uses the formulae given in [1] on pages 318-319,
 ## 'Solving for the LS Estimate by QR Factorization'.
+## The R factor is computed as the Cholesky factor of the covariance
+## matrix of the regressors, which is accumulated in compiled code by
+## exploiting the Toeplitz structure of the lagged signals.
 ## Uses @uref{https://github.com/SLICOT/SLICOT-Reference, SLICOT IB01CD}
 ## for initial conditions,
 ## Copyright (c) 2020, SLICOT, available under the BSD 3-Clause
@@ -96,24 +115,32 @@
 
 ## Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 ## Created: April 2012
-## Version: 0.1
+## Version: 0.3
 
 function [sys, varargout] = arx (dat, varargin)
 
-  ## TODO: delays
-
   if (nargin < 2)
     print_usage ();
   endif
   
-  if (! isa (dat, "iddata") || ! dat.timedomain)
+  ## experiments of a binary iddata file, see iddataread
+  mapped = isstruct (dat);
+
+  if (mapped)
+    if (! all (isfield (dat, {"file", "offset", "nsmp", "outputs", "inputs", "precision", "tsam"})))
+      error ("arx: first argument must be a time-domain iddata dataset or a mapped iddata file");
+    endif
+    p = dat(1).outputs;
+    m = dat(1).inputs;
+    ex = numel (dat);
+  elseif (! isa (dat, "iddata") || ! dat.timedomain)
     error ("arx: first argument must be a time-domain iddata dataset");
+  else
+    ## p: outputs,  m: inputs,  ex: experiments
+    [~, p, m, ex] = size (dat);         # dataset dimensions
   endif
 
-  ## p: outputs,  m: inputs,  ex: experiments
-  [~, p, m, ex] = size (dat);           # dataset dimensions
-
-  if (is_real_scalar (varargin{1}))     # arx (dat, n, ...)
+  if (is_real_vector (varargin{1}))     # arx (dat, n, ...)
     varargin = horzcat (varargin(2:end), {"na"}, varargin(1), {"nb"}, varargin(1));
   endif
 
@@ -143,7 +170,7 @@ function [sys, varargout] = arx (dat, varargin)
         nb = __check_n__ (val, "nb");
       case "nk"
         nk = __check_n__ (val, "nk");
-        if (! issample (val, 0))
+        if (! is_real_vector (val) || rows (val) != 1 || any (val < 0))
           error ("arx: channel-wise 'nk' matrices not supported yet");
         endif
       otherwise
@@ -151,15 +178,17 @@ function [sys, varargout] = arx (dat, varargin)
     endswitch
   endfor
 
-  if (any (nk(:) != 0))
-    dat = nkshift (dat, nk);
+  ## extract data, mapped files are passed on as they are
+  if (mapped)
+    Y = dat;
+    U = [];
+    tsam = {dat.tsam};
+  else
+    Y = dat.y;
+    U = dat.u;
+    tsam = dat.tsam;
   endif
 
-  ## extract data  
-  Y = dat.y;
-  U = dat.u;
-  tsam = dat.tsam;
-
   ## multi-experiment data requires equal sampling times  
   if (ex > 1 && ! isequal (tsam{:}))
     error ("arx: require equally sampled experiments");
@@ -167,108 +196,140 @@ function [sys, varargout] = arx (dat, varargin)
     tsam = tsam{1};
   endif
 
-  if (is_real_scalar (na, nb))
-    na = repmat (na, p, 1);                         # na(p-by-1)
-    nb = repmat (nb, p, m);                         # nb(p-by-m)
-  elseif (! (is_real_vector (na) && is_real_matrix (nb) ...
-          && rows (na) == p && rows (nb) == p && columns (nb) == m))
-    error ("arx: require na(%dx1) instead of (%dx%d) and nb(%dx%d) instead of (%dx%d)", ...
-            p, rows (na), columns (na), p, m, rows (nb), columns (nb));
+  ## several structures:  row vectors na, nb and nk of equal length,
+  ## the same orders for all channels
+  multi = (rows (na) == 1 && columns (na) > 1) || numel (nk) > 1;
+
+  if (multi)
+    nst = max ([numel(na), numel(nb), numel(nk)]);
+    if (! (is_real_vector (na, nb) && rows (na) == 1 && rows (nb) == 1)
+        || ! all (ismember ([numel(na), numel(nb), numel(nk)], [1, nst])))
+      error ("arx: require row vectors 'na', 'nb' and 'nk' of equal length for several structures");
+    endif
+    na = repmat (na, 1, nst / numel (na));
+    nb = repmat (nb, 1, nst / numel (nb));
+    nk = repmat (nk, 1, nst / numel (nk));
+    NA = repmat (na, p, 1);                         # NA(p-by-nst)
+    NB = repmat (nb, p*m, 1);                       # NB(p*m-by-nst), one nb(p-by-m) per column
+  else
+    nst = 1;
+    if (is_real_scalar (na, nb))
+      na = repmat (na, p, 1);                       # na(p-by-1)
+      nb = repmat (nb, p, m);                       # nb(p-by-m)
+    elseif (! (is_real_vector (na) && is_real_matrix (nb) ...
+            && rows (na) == p && rows (nb) == p && columns (nb) == m))
+      error ("arx: require na(%dx1) instead of (%dx%d) and nb(%dx%d) instead of (%dx%d)", ...
+              p, rows (na), columns (na), p, m, rows (nb), columns (nb));
+    endif
+    NA = na(:);
+    NB = nb(:);
   endif
 
-  max_nb = max (nb, [], 2);                         # one maximum for each row/output, max_nb(p-by-1)
-  n = max (na, max_nb);                             # n(p-by-1)
-
-  ## create empty cells for numerator and denominator polynomials
-  num = cell (p, m+p);
-  den = cell (p, m+p);
-
-  ## MIMO (p-by-m) models are identified as p MISO (1-by-m) models
-  ## For multi-experiment data, minimize the trace of the error
-  for i = 1 : p                                     # for every output
-    Phi = cell (ex, 1);                             # one regression matrix per experiment
-    for e = 1 : ex                                  # for every experiment  
-      ## avoid warning: toeplitz: column wins anti-diagonal conflict
-      ## therefore set first row element equal to y(1)
-      PhiY = toeplitz (Y{e}(1:end-1, i), [Y{e}(1, i); zeros(na(i)-1, 1)]);
-      ## create MISO Phi for every experiment
-      PhiU = arrayfun (@(x) toeplitz (U{e}(1:end-1, x), [U{e}(1, x); zeros(nb(i,x)-1, 1)]), 1:m, "uniformoutput", false);
-      Phi{e} = (horzcat (-PhiY, PhiU{:}))(n(i):end, :);
+  ## covariance matrices of the regression problems of all structures
+  ## and outputs, computed in one pass over the data
+  [G, nrows] = __sl_arx__ (Y, U, NA, NB, nk);
+
+  sys = x0 = cell (1, nst);
+
+  ## the initial state requires the signals
+  if (mapped && nargout > 1)
+    dat = __read_mapped__ (dat);
+  endif
+
+  for k = 1 : nst
+    na = NA(:,k);                                   # na(p-by-1)
+    nb = reshape (NB(:,k), p, m);                   # nb(p-by-m)
+
+    ## create empty cells for numerator and denominator polynomials
+    num = cell (p, m+p);
+    den = cell (p, m+p);
+
+    ## MIMO (p-by-m) models are identified as p MISO (1-by-m) models
+    ## For multi-experiment data, minimize the trace of the error
+    for i = 1 : p                                   # for every output
+      if (nrows(i,k) < na(i) + sum (nb(i,:)))
+        error ("arx: the dataset does not contain enough samples for na = %d and nb = %d", ...
+               na(i), max (nb(i,:)));
+      endif
+
+      ## compute parameter vector Theta
+      Theta = __theta__ (G{i,k}, na(i));
+
+      ## extract polynomial matrices A and B from Theta
+      ## A is a scalar polynomial for output i, i=1:p
+      ## B is polynomial row vector (1-by-m) for output i
+      A = [1; Theta(1:na(i))];                              # a0 = 1, a1 = Theta(1), an = Theta(n)
+      ThetaB = Theta(na(i)+1:end);                          # all polynomials from B are in one column vector
+      B = mat2cell (ThetaB, nb(i,:));                       # now separate the polynomials, one for each input
+      B = reshape (B, 1, []);                               # make B a row cell (1-by-m)
+      B = cellfun (@(B) [zeros(1+nk(k), 1); B], B, "uniformoutput", false);  # b0 = 0 (leading zero required by filt)
+
+      ## add error inputs
+      Be = repmat ({0}, 1, p);                              # there are as many error inputs as system outputs (p)
+      Be(i) = [zeros(1,nk(k)), 1];                          # inputs m+1:m+p are zero, except m+i which is one
+      num(i, :) = [B, Be];                                  # numerator polynomials for output i, individual for each input
+      den(i, :) = repmat ({A}, 1, m+p);                     # in a row (output i), all inputs have the same denominator polynomial
     endfor
 
-    ## compute parameter vector Theta
-    Theta = __theta__ (Phi, Y, i, n);
-
-    ## extract polynomial matrices A and B from Theta
-    ## A is a scalar polynomial for output i, i=1:p
-    ## B is polynomial row vector (1-by-m) for output i
-    A = [1; Theta(1:na(i))];                                # a0 = 1, a1 = Theta(1), an = Theta(n)
-    ThetaB = Theta(na(i)+1:end);                            # all polynomials from B are in one column vector
-    B = mat2cell (ThetaB, nb(i,:));                         # now separate the polynomials, one for each input
-    B = reshape (B, 1, []);                                 # make B a row cell (1-by-m)
-    B = cellfun (@(B) [zeros(1+nk, 1); B], B, "uniformoutput", false);  # b0 = 0 (leading zero required by filt)
-
-    ## add error inputs
-    Be = repmat ({0}, 1, p);                                # there are as many error inputs as system outputs (p)
-    Be(i) = [zeros(1,nk), 1];                               # inputs m+1:m+p are zero, except m+i which is one
-    num(i, :) = [B, Be];                                    # numerator polynomials for output i, individual for each input
-    den(i, :) = repmat ({A}, 1, m+p);                       # in a row (output i), all inputs have the same denominator polynomial
+    ## A(q) y(t) = B(q) u(t) + e(t)
+    ## there is only one A per row
+    ## B(z) and A(z) are a Matrix Fraction Description (MFD)
+    ## y = A^-1(q) B(q) u(t) + A^-1(q) e(t)
+    ## since A(q) is a diagonal polynomial matrix, its inverse is trivial:
+    ## the corresponding transfer function has common row denominators.
+
+    sys{k} = filt (num, den, tsam);                         # filt creates a transfer function in z^-1
+
+    ## compute initial state vector x0 if requested
+    ## this makes only sense for state-space models, therefore convert TF to SS
+    if (nargout > 1)
+      sys{k} = prescale (ss (sys{k}(:,1:m)));
+      datk = dat;
+      if (nk(k) != 0)
+        datk = nkshift (dat, nk(k));
+      endif
+      x0{k} = __sl_ib01cd__ (datk.y, datk.u, sys{k}.a, sys{k}.b, sys{k}.c, sys{k}.d, 0.0);
+      ## return x0 as vector for single-experiment data
+      ## instead of a cell containing one vector
+      if (numel (x0{k}) == 1)
+        x0{k} = x0{k}{1};
+      endif
+    endif
   endfor
 
-  ## A(q) y(t) = B(q) u(t) + e(t)
-  ## there is only one A per row
-  ## B(z) and A(z) are a Matrix Fraction Description (MFD)
-  ## y = A^-1(q) B(q) u(t) + A^-1(q) e(t)
-  ## since A(q) is a diagonal polynomial matrix, its inverse is trivial:
-  ## the corresponding transfer function has common row denominators.
-
-  sys = filt (num, den, tsam);                              # filt creates a transfer function in z^-1
+  ## one model unless several structures are requested
+  if (! multi)
+    sys = sys{1};
+    x0 = x0{1};
+  endif
 
-  ## compute initial state vector x0 if requested
-  ## this makes only sense for state-space models, therefore convert TF to SS
   if (nargout > 1)
-    sys = prescale (ss (sys(:,1:m)));
-    x0 = __sl_ib01cd__ (Y, U, sys.a, sys.b, sys.c, sys.d, 0.0);
-    ## return x0 as vector for single-experiment data
-    ## instead of a cell containing one vector
-    if (numel (x0) == 1)
-      x0 = x0{1};
-    endif
     varargout{1} = x0;
   endif
 
 endfunction
 
 
-function Theta = __theta__ (Phi, Y, i, n)
-    
-  if (numel (Phi) == 1)                             # single-experiment dataset
-    ## use "square-root algorithm"
-    A = horzcat (Phi{1}, Y{1}(n(i)+1:end, i));      # [Phi, Y]
-    R0 = triu (qr (A, 0));                          # 0 for economy-size R (without zero rows)
-    R1 = R0(1:end-1, 1:end-1);                      # R1 is triangular - can we exploit this in R1\R2?
+function Theta = __theta__ (G, na)
+
+  ## G is the covariance matrix of [Phi, Y] with the past outputs as
+  ## positive regressors, the A coefficients require the opposite sign
+  d = [-ones(na, 1); ones(rows (G) - na, 1)];
+  G = d .* G .* d.';
+
+  ## "square-root algorithm", the Cholesky factor of [Phi, Y]'[Phi, Y]
+  ## is the R factor of the QR factorization of [Phi, Y]
+  [R0, fail] = chol (G);
+
+  if (! fail)
+    R1 = R0(1:end-1, 1:end-1);                      # R1 is triangular
     R2 = R0(1:end-1, end);
     Theta = __ls_svd__ (R1, R2);                    # R1 \ R2
-    
-    ## Theta = Phi \ Y(n+1:end, :);                 # naive formula
-    ## Theta = __ls_svd__ (Phi{1}, Y{1}(n(i)+1:end, i));
-  else                                              # multi-experiment dataset
-    ## TODO: find more sophisticated formula than
-    ## Theta = (Phi1' Phi1 + Phi2' Phi2 + ...) \ (Phi1' Y1 + Phi2' Y2 + ...)
-    
-    ## covariance matrix C = (Phi1' Phi + Phi2' Phi2 + ...)
-    tmp = cellfun (@(Phi) Phi.' * Phi, Phi, "uniformoutput", false);
-    ## rc = cellfun (@rcond, tmp);                     # also test C? QR or SVD?
-    C = plus (tmp{:});
-
-    ## PhiTY = (Phi1' Y1 + Phi2' Y2 + ...)
-    tmp = cellfun (@(Phi, Y) Phi.' * Y(n(i)+1:end, i), Phi, Y, "uniformoutput", false);
-    PhiTY = plus (tmp{:});
-    
-    ## pseudoinverse  Theta = C \ Phi'Y
-    Theta = __ls_svd__ (C, PhiTY);
+  else
+    ## rank-deficient, pseudoinverse  Theta = (Phi' Phi) \ Phi'Y
+    Theta = __ls_svd__ (G(1:end-1, 1:end-1), G(1:end-1, end));
   endif
-  
+
 endfunction
 
 
@@ -300,6 +361,27 @@ function x = __ls_svd__ (A, b)
 endfunction
 
 
+## read the experiments of a mapped iddata file
+function dat = __read_mapped__ (src)
+
+  y = u = cell (numel (src), 1);
+
+  for k = 1 : numel (src)
+    [fid, msg] = fopen (src(k).file, "r", "ieee-le");
+    if (fid < 0)
+      error ("arx: %s", msg);
+    endif
+    fseek (fid, src(k).offset, SEEK_SET);
+    y{k} = fread (fid, [src(k).nsmp, src(k).outputs], [src(k).precision, "=>double"]);
+    u{k} = fread (fid, [src(k).nsmp, src(k).inputs], [src(k).precision, "=>double"]);
+    fclose (fid);
+  endfor
+
+  dat = iddata (y, u, {src.tsam});
+
+endfunction
+
+
 function val = __check_n__ (val, str = "n")
   
   if (! is_real_matrix (val) || fix (val) != val)
@@ -307,3 +389,31 @@ function val = __check_n__ (val, str = "n")
   endif
 
 endfunction
+
+
+## several structures from one pass over the data
+%!test
+%! sys = filt ([0, 0.5, 0.2], [1, -1.2, 0.5], 1);
+%! u = sin ((1:400).' / 5) + cos ((1:400).' / 3) + sin ((1:400).' / 2);
+%! dat = iddata (lsim (sys, u), u, 1);
+%! sysv = arx (dat, [1, 2, 3]);
+%! assert (size (sysv), [1, 3]);
+%! for k = 1 : 3
+%!   sysk = arx (dat, k);
+%!   [nv, dv] = tfdata (sysv{k}, "vector");
+%!   [nk, dk] = tfdata (sysk, "vector");
+%!   assert (dv, dk, 1e-8);
+%!   assert (nv, nk, 1e-8);
+%! endfor
+%! [~, den] = tfdata (sysv{2}(1,1), "vector");
+%! assert (den, [1, -1.2, 0.5], 1e-6);
+
+%!test
+%! sys = filt ([0, 0, 0.5, 0.2], [1, -1.2, 0.5], 1);
+%! u = sin ((1:400).' / 5) + cos ((1:400).' / 3) + sin ((1:400).' / 2);
+%! dat = iddata (lsim (sys, u), u, 1);
+%! sysv = arx (dat, "na", 2, "nb", 2, "nk", [0, 1]);
+%! [~, den] = tfdata (sysv{2}(1,1), "vector");
+%! assert (den, [1, -1.2, 0.5], 1e-6);
+
+%!error <equal length> arx (iddata (rand (100, 1), rand (100, 1)), "na", [1, 2], "nb", [1, 2, 3])
@@ -106,8 +106,34 @@
 ## Use the square-root Balance & Truncate method.
 ## @item 'bfsr', 'f'
 ## Use the balancing-free square-root Balance & Truncate method.  Default method.
+## @item 'lr', 'lowrank'
+## Use a low-rank method for large models.  The Gramians are not formed,
+## instead low-rank factors are computed by the ADI iteration and the
+## leading Hankel singular values by a (randomized) SVD of the product
+## of these factors.  The system must be stable, frequency weightings
+## are not supported and option 'alpha' is ignored.
 ## @end table
 ##
+## @item 'adi-tol'
+## Relative residual tolerance of the low-rank ADI iteration.
+## Only used with method 'lowrank'.  Default value is 1e-10.
+##
+## @item 'adi-maxiter'
+## Maximum number of low-rank ADI steps.
+## Only used with method 'lowrank'.  Default value is 100.
+##
+## @item 'frequency-band'
+## Frequency interval [w1, w2] in rad/s, 0 <= w1 < w2 <= Inf, of special
+## interest.  The frequency-limited Gramians of this band replace the
+## ordinary ones, such that the approximation error is small inside the
+## band.  The stability of @var{Gr} is not guaranteed.
+##
+## @item 'time-interval'
+## Time interval [t1, t2], 0 <= t1 < t2 <= Inf, of special interest.
+## The time-limited Gramians of this interval replace the ordinary ones.
+## For finite t2, unstable models are admissible.  The stability of
+## @var{Gr} is not guaranteed.
+##
 ## @item 'alpha'
 ## Specifies the ALPHA-stability boundary for the eigenvalues
 ## of the state dynamics matrix @var{G.A}.  For a continuous-time
@@ -230,6 +256,10 @@
 ## balancing related model reduction}.
 ## (report in preparation)
 ##
+## [5] Gawronski, W. and Juang, J.-N.
+## @cite{Model reduction in limited time and frequency intervals}.
+## Int. J. Systems Science, vol. 21, no. 2, pp. 349-376, 1990.
+##
 ##
 ## @strong{Algorithm}@*
 ## Uses @uref{https://github.com/SLICOT/SLICOT-Reference, SLICOT AB09ID},
@@ -330,3 +360,68 @@ endfunction
 %!
 %!assert (Mo, Me, 1e-4);
 %!assert (Info.hsv, HSVe, 1e-4);
+
+## low-rank method against dense Gramians
+%!test
+%! n = 40;
+%! a = diag (-(1:n)) + diag (0.5*ones (n-1, 1), 1);
+%! b = [ones(n, 1), (1:n).'/n];
+%! c = [1, zeros(1, n-1); (-1).^(1:n)];
+%! d = zeros (2);
+%! G = ss (a, b, c, d);
+%! [Gr, info] = btamodred (G, 6, "scale", false);
+%! [Grl, infol] = btamodred (G, 6, "method", "lowrank");
+%! assert (infol.nr, 6);
+%! assert (infol.hsv(1:6), info.hsv(1:6), 1e-6*info.hsv(1));
+%! w = logspace (-2, 2, 30);
+%! H = freqresp (Gr, w);
+%! Hl = freqresp (Grl, w);
+%! assert (Hl, H, 1e-6*max (abs (H(:))));
+
+%!test
+%! a = [0.5, 0.2, 0; 0, -0.3, 0.1; 0, 0, 0.1];
+%! G = ss (a, [1; 0; 1], [1, 1, 0], 0, 1);
+%! [~, info] = btamodred (G, 2, "scale", false);
+%! [~, infol] = btamodred (G, 2, "method", "lowrank");
+%! assert (infol.hsv(1:2), info.hsv(1:2), 1e-6*info.hsv(1));
+
+%!error <stable> btamodred (ss (1, 1, 1, 0), 1, "method", "lowrank")
+
+## frequency- and time-limited Gramians
+%!test
+%! n = 20;
+%! a = diag (-(1:n)) + diag (0.5*ones (n-1, 1), 1);
+%! G = ss (a, ones (n, 1), (-1).^(1:n), 0);
+%! [~, info] = btamodred (G, 4, "scale", false);
+%! [~, infob] = btamodred (G, 4, "frequency-band", [0, Inf]);
+%! [~, infot] = btamodred (G, 4, "time-interval", [0, Inf]);
+%! assert (infob.hsv(1:4), info.hsv(1:4), 1e-8*info.hsv(1));
+%! assert (infot.hsv(1:4), info.hsv(1:4), 1e-8*info.hsv(1));
+
+%!test
+%! a = blkdiag ([-0.1, 10; -10, -0.1], [-0.2, 1; -1, -0.2], -5);
+%! G = ss (a, [1; 1; 1; 1; 1], [1, 0, 1, 0, 1], 0);
+%! Gr = btamodred (G, 2, "frequency-band", [8, 12], "method", "sr");
+%! w = linspace (9, 11, 20);
+%! H = squeeze (freqresp (G, w));
+%! Hr = squeeze (freqresp (Gr, w));
+%! assert (Hr, H, 0.05*max (abs (H)));
+
+%!test
+%! a = [0.5, 0.2, 0; 0, -0.3, 0.1; 0, 0, 0.1];
+%! G = ss (a, [1; 0; 1], [1, 1, 0], 0, 1);
+%! [~, info] = btamodred (G, 2, "scale", false);
+%! [~, infob] = btamodred (G, 2, "frequency-band", [0, pi]);
+%! assert (infob.hsv, info.hsv, 1e-8*info.hsv(1));
+
+%!test
+%! a = [0.1, 1, 0; 0, -1, 1; 0, 0, -2];
+%! G = ss (a, [0; 0; 1], [1, 0, 0], 0);
+%! Gr = btamodred (G, 2, "time-interval", [0, 2]);
+%! t = linspace (0, 2, 21);
+%! y = impulse (G, t);
+%! yr = impulse (Gr, t);
+%! assert (yr, y, 0.1*max (abs (y)));
+
+%!error <mutually exclusive> btamodred (ss (-1, 1, 1, 0), 1, "frequency-band", [0, 1], "time-interval", [0, 1])
+%!error <frequency-band> btamodred (ss (-1, 1, 1, 0), 1, "frequency-band", [2, 1])
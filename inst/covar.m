@@ -17,6 +17,7 @@
 
 ## -*- texinfo -*-
 ## @deftypefn{Function File} {[@var{p}, @var{q}] =} covar (@var{sys}, @var{w})
+## @deftypefnx{Function File} {[@var{p}, @var{q}] =} covar (@var{sys}, @var{w}, @var{"method"}, @var{"smith"}, @dots{})
 ## Return the steady-state covariance.
 ##
 ## @strong{Inputs}
@@ -25,6 +26,11 @@
 ## @acronym{LTI} model.
 ## @item w
 ## Intensity of Gaussian white noise inputs which drive @var{sys}.
+## @item @dots{}
+## Optional property/value pairs @var{"method"}, @var{"tol"} and
+## @var{"maxiter"} for discrete-time systems, passed to @command{dlyap}.
+## With @var{"method"} set to @var{"smith"}, the state covariance is
+## computed by the squared Smith iteration.
 ## @end table
 ##
 ## @strong{Outputs}
@@ -42,9 +48,9 @@
 ## Created: January 2010
 ## Version: 0.1
 
-function [p, q] = covar (sys, w)
+function [p, q] = covar (sys, w, varargin)
 
-  if (nargin != 2)
+  if (nargin < 2)
     print_usage ();
   endif
   
@@ -59,6 +65,9 @@ function [p, q] = covar (sys, w)
   [a, b, c, d] = ssdata (sys);
   
   if (isct (sys))
+    if (! isempty (varargin))
+      error ("covar: solver options are only supported for discrete-time systems");
+    endif
     if (any (d(:)))
       error ("covar: system is not strictly proper");
     endif
@@ -66,7 +75,7 @@ function [p, q] = covar (sys, w)
     q = lyap (a, b*w*b.');
     p = c*q*c.';
   else
-    q = dlyap (a, b*w*b.');
+    q = dlyap (a, b*w*b.', varargin{:});
     p = c*q*c.' + d*w*d.';
   endif
 
@@ -90,3 +99,10 @@ endfunction
 %! q_exp = [27.1493, -3.6199; -3.6199, 27.1493];
 %!assert (p, p_exp, 1e-4);
 %!assert (q, q_exp, 1e-4);
+
+## discrete-time, Smith iteration
+%!test
+%! sys = ss ([-0.2, -0.5; 1, 0], [2; 0], [1, 0.5], [0], 0.1);
+%! [p, q] = covar (sys, 5, "method", "smith");
+%!assert (p, 30.3167, 1e-4);
+%!assert (q, [27.1493, -3.6199; -3.6199, 27.1493], 1e-4);
@@ -21,6 +21,8 @@
 ## @deftypefnx {Function File} {[@var{m}, @var{p}, @var{z}, @var{e}] =} dlqe (@var{a}, @var{g}, @var{c}, @var{q}, @var{r}, @var{s})
 ## @deftypefnx {Function File} {[@var{m}, @var{p}, @var{z}, @var{e}] =} dlqe (@var{a}, @var{[]}, @var{c}, @var{q}, @var{r})
 ## @deftypefnx {Function File} {[@var{m}, @var{p}, @var{z}, @var{e}] =} dlqe (@var{a}, @var{[]}, @var{c}, @var{q}, @var{r}, @var{s})
+## @deftypefnx {Function File} {[@var{m}, @var{p}, @var{z}, @var{e}] =} dlqe (@dots{}, @var{"horizon"}, @var{N})
+## @deftypefnx {Function File} {[@var{m}, @var{p}, @var{z}, @var{e}] =} dlqe (@dots{}, @var{"horizon"}, @var{N}, @var{"initial"}, @var{p0})
 ## Kalman filter for discrete-time systems.
 ##
 ## @example
@@ -47,6 +49,15 @@
 ## @item s
 ## Optional cross term covariance matrix (g-by-p), s = cov(w,v).
 ## If @var{s} is empty @code{[]} or not specified, a zero matrix is assumed.
+## @item "horizon", N
+## Compute the time-varying Kalman filter over @var{N} steps by the forward
+## Riccati difference recursion instead of the algebraic Riccati equation.
+## In this case, @var{a}, @var{c}, @var{q}, @var{r} and @var{s} may be
+## given as 3-D arrays with @var{N} pages for time-varying problems,
+## where page k+1 holds the matrix for step k.
+## @item "initial", p0
+## Initial error covariance matrix (n-by-n), cov(x(0|-1)-x), for the
+## finite-horizon problem.  Default value is a zero matrix.
 ## @end table
 ##
 ## @strong{Outputs}
@@ -62,6 +73,11 @@
 ## Closed-loop poles (n-by-1).
 ## @end table
 ##
+## For the finite-horizon problem, @var{m} is an n-by-p-by-N array of
+## filter gains, @var{p} an n-by-n-by-(N+1) array of error covariances
+## with @var{p}(:,:,1) = @var{p0}, @var{z} an n-by-n-by-N array, and
+## @var{e} contains the closed-loop poles of the last step.
+##
 ## @strong{Equations}
 ## @example
 ## @group
@@ -85,12 +101,22 @@
 ## Created: April 2012
 ## Version: 0.1
 
-function [m, p, z, e] = dlqe (a, g, c, q, r, s = [])
+function [m, p, z, e] = dlqe (a, g, c, q, r, s = [], varargin)
+
+  if (nargin >= 6 && ischar (s))
+    varargin = [{s}, varargin];
+    s = [];
+  endif
 
-  if (nargin < 5 || nargin > 6)
+  if (nargin < 5 || rem (numel (varargin), 2))
     print_usage ();
   endif
 
+  if (! isempty (varargin))
+    [m, p, z, e] = __dlqe_horizon__ (a, g, c, q, r, s, varargin{:});
+    return;
+  endif
+
   if (isempty (g))
     [p, e] = dare (a.', c.', q, r, s);   # dlqe (a, [], c, q, r, s), g=I
   elseif (columns (g) != rows (q) || ! issquare (q))
@@ -111,3 +137,114 @@ function [m, p, z, e] = dlqe (a, g, c, q, r, s = [])
   z = (z + z.') / 2;
 
 endfunction
+
+
+function [m, p, z, e] = __dlqe_horizon__ (a, g, c, q, r, s, varargin)
+
+  horizon = [];
+  p0 = [];
+
+  for k = 1 : 2 : numel (varargin)
+    key = __match_key__ (varargin{k}, {"horizon", "initial"}, "dlqe");
+    val = varargin{k+1};
+    switch (key)
+      case "horizon"
+        if (! is_real_scalar (val) || val < 1 || fix (val) != val)
+          error ("dlqe: horizon must be a positive integer");
+        endif
+        horizon = val;
+      case "initial"
+        p0 = val;
+    endswitch
+  endfor
+
+  if (isempty (horizon))
+    error ("dlqe: property 'initial' requires a finite 'horizon'");
+  endif
+
+  n = rows (a);
+  ny = rows (c);
+
+  ## process noise g*w enters as q := g*q*g.', s := g*s
+  if (! isempty (g))
+    if (! is_real_matrix (g) || rows (g) != n || columns (g) != rows (q))
+      error ("dlqe: g must be a real %dx%d matrix", n, rows (q));
+    endif
+    nq = size (q, 3);
+    qg = zeros (n, n, nq);
+    for k = 1 : nq
+      qg(:,:,k) = g * q(:,:,k) * g.';
+    endfor
+    q = qg;
+    if (! isempty (s))
+      s = reshape (g * reshape (s, rows (s), []), n, ny, []);
+    endif
+  endif
+
+  if (isempty (s))
+    s = zeros (n, ny);
+  endif
+
+  if (isempty (p0))
+    p0 = zeros (n);
+  endif
+
+  chk = {a, [n, n], "a"; c, [ny, n], "c"; q, [n, n], "q"; ...
+         r, [ny, ny], "r"; s, [n, ny], "s"};
+
+  for k = 1 : rows (chk)
+    tmp = chk{k,1};
+    if (! isnumeric (tmp) || ! isreal (tmp) || ndims (tmp) > 3
+        || ! isequal (size (tmp)(1:2), chk{k,2})
+        || ! any (size (tmp, 3) == [1, horizon]))
+      error ("dlqe: %s must be a real %dx%d matrix or %dx%dx%d array", ...
+             chk{k,3}, chk{k,2}, chk{k,2}, horizon);
+    endif
+  endfor
+
+  if (! is_real_square_matrix (p0) || rows (p0) != n)
+    error ("dlqe: initial covariance p0 must be a real %dx%d matrix", n, n);
+  endif
+
+  [m, p, z, l] = __sl_rde__ (a, c, q, r, s, p0, horizon, true);
+
+  e = eig (a(:,:,end) - l(:,:,end) * c(:,:,end));
+
+endfunction
+
+
+## finite horizon converges to the steady-state filter
+%!shared m, p, z, e, m_exp, p_exp, z_exp, e_exp
+%! a = [0.9, 0.2; 0, 0.7];
+%! g = [1; 0.5];
+%! c = [1, 0];
+%! q = 2;
+%! r = 0.5;
+%! [m_exp, p_exp, z_exp, e_exp] = dlqe (a, g, c, q, r);
+%! [m, p, z, e] = dlqe (a, g, c, q, r, "horizon", 200, "initial", eye (2));
+%!assert (size (m), [2, 1, 200]);
+%!assert (size (p), [2, 2, 201]);
+%!assert (m(:,:,end), m_exp, 1e-8);
+%!assert (p(:,:,end), p_exp, 1e-8);
+%!assert (z(:,:,end), z_exp, 1e-8);
+%!assert (sort (e), sort (e_exp), 1e-8);
+
+## finite horizon against plain recursion
+%!test
+%! a = [1.1, 0.3; -0.2, 0.8];
+%! c = [1, 1];
+%! q = [2, 0.5; 0.5, 1];
+%! r = 1;
+%! p0 = [3, 1; 1, 2];
+%! N = 5;
+%! p = zeros (2, 2, N+1);
+%! m = zeros (2, 1, N);
+%! p(:,:,1) = p0;
+%! for k = 1 : N
+%!   m(:,:,k) = p(:,:,k)*c' / (c*p(:,:,k)*c' + r);
+%!   z = p(:,:,k) - m(:,:,k)*c*p(:,:,k);
+%!   p(:,:,k+1) = a*z*a' + q;
+%! endfor
+%! [mt, pt] = dlqe (a, [], c, q, r, "horizon", N, "initial", p0);
+%!assert (mt, m, 1e-10);
+%!assert (pt, p, 1e-10);
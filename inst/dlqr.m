@@ -22,6 +22,8 @@
 ## @deftypefnx {Function File} {[@var{g}, @var{x}, @var{l}] =} dlqr (@var{a}, @var{b}, @var{q}, @var{r}, @var{s})
 ## @deftypefnx {Function File} {[@var{g}, @var{x}, @var{l}] =} dlqr (@var{a}, @var{b}, @var{q}, @var{r}, @var{[]}, @var{e})
 ## @deftypefnx {Function File} {[@var{g}, @var{x}, @var{l}] =} dlqr (@var{a}, @var{b}, @var{q}, @var{r}, @var{s}, @var{e})
+## @deftypefnx {Function File} {[@var{g}, @var{x}, @var{l}] =} dlqr (@dots{}, @var{"horizon"}, @var{N})
+## @deftypefnx {Function File} {[@var{g}, @var{x}, @var{l}] =} dlqr (@dots{}, @var{"horizon"}, @var{N}, @var{"final"}, @var{xf})
 ## Linear-quadratic regulator for discrete-time systems.
 ##
 ## @strong{Inputs}
@@ -40,6 +42,16 @@
 ## Optional cross term matrix (n-by-m).  If @var{s} is not specified, a zero matrix is assumed.
 ## @item e
 ## Optional descriptor matrix (n-by-n).  If @var{e} is not specified, an identity matrix is assumed.
+## @item "horizon", N
+## Solve the finite-horizon problem over @var{N} steps by the backward
+## Riccati difference recursion instead of the algebraic Riccati equation.
+## In this case, @var{a}, @var{b}, @var{q}, @var{r} and @var{s} may be
+## given as 3-D arrays with @var{N} pages for time-varying problems,
+## where page k+1 holds the matrix for step k.
+## Descriptor systems are not supported.
+## @item "final", xf
+## Terminal state weighting matrix (n-by-n) for the finite-horizon problem.
+## Default value is a zero matrix.
 ## @end table
 ##
 ## @strong{Outputs}
@@ -52,6 +64,11 @@
 ## Closed-loop poles (n-by-1).
 ## @end table
 ##
+## For the finite-horizon problem, @var{g} is an m-by-n-by-N array of
+## feedback matrices, @var{x} is an n-by-n-by-(N+1) array with the
+## solutions of the Riccati difference equation, @var{x}(:,:,N+1) = @var{xf},
+## and @var{l} contains the closed-loop poles of the first step.
+##
 ## @strong{Equations}
 ## @example
 ## @group
@@ -62,8 +79,19 @@
 ##         k=0
 ##
 ## L = eig (A - B*G)
+##
+##         N-1
+## J(x0) = SUM (x' Q x  +  u' R u  +  2 x' S u)  +  x[N]' Xf x[N]
+##         k=0
+##
+## u[k] = -G[k] x[k]
 ## @end group
 ## @end example
+##
+## @strong{Algorithm}@*
+## The finite-horizon problem is solved by a square-root formulation
+## of the Riccati difference equation, propagating a factor of @var{x}
+## by one QR factorization per step.
 ## @seealso{dare, care, lqr}
 ## @end deftypefn
 
@@ -71,27 +99,168 @@
 ## Created: November 2009
 ## Version: 0.2
 
-function [g, x, l] = dlqr (a, b, q, r = [], s = [], e = [])
+function [g, x, l] = dlqr (varargin)
+
+  ## trailing property/value pairs for the finite-horizon problem
+  horizon = [];
+  xf = [];
+
+  kidx = find (cellfun (@ischar, varargin), 1);
+
+  if (! isempty (kidx))
+    opts = varargin(kidx:end);
+    varargin = varargin(1:kidx-1);
+
+    if (rem (numel (opts), 2))
+      error ("dlqr: properties and values must come in pairs");
+    endif
 
-  if (nargin < 3 || nargin > 6)
+    for k = 1 : 2 : numel (opts)
+      key = __match_key__ (opts{k}, {"horizon", "final"}, "dlqr");
+      val = opts{k+1};
+      switch (key)
+        case "horizon"
+          if (! is_real_scalar (val) || val < 1 || fix (val) != val)
+            error ("dlqr: horizon must be a positive integer");
+          endif
+          horizon = val;
+        case "final"
+          xf = val;
+      endswitch
+    endfor
+
+    if (isempty (horizon))
+      error ("dlqr: property 'final' requires a finite 'horizon'");
+    endif
+  endif
+
+  nargs = numel (varargin);
+
+  if (nargs < 3 || nargs > 6)
     print_usage ();
   endif
 
+  varargin(end+1:6) = {[]};
+  [a, b, q, r, s, e] = varargin{:};
+
   if (isa (a, "lti"))
+    if (! isempty (horizon) && isct (a))
+      error ("dlqr: finite horizon requires a discrete-time system");
+    endif
     s = r;
     r = q;
     q = b;
     [a, b, c, d, e, tsam] = dssdata (a, []);
-  elseif (nargin < 4)
+  elseif (nargs < 4)
     print_usage ();
   else
     tsam = 1;  # any value > 0 could be used here
   endif
 
-  if (issample (tsam, -1))
+  if (! isempty (horizon))
+    [g, x, l] = __dlqr_horizon__ (a, b, q, r, s, e, xf, horizon);
+  elseif (issample (tsam, -1))
     [x, l, g] = dare (a, b, q, r, s, e);
   else
     [x, l, g] = care (a, b, q, r, s, e);
   endif
 
 endfunction
+
+
+function [g, x, l] = __dlqr_horizon__ (a, b, q, r, s, e, xf, horizon)
+
+  if (! isempty (e))
+    error ("dlqr: descriptor systems are not supported for finite horizon");
+  endif
+
+  n = rows (a);
+  m = columns (b);
+
+  if (isempty (s))
+    s = zeros (n, m);
+  endif
+
+  if (isempty (xf))
+    xf = zeros (n);
+  endif
+
+  chk = {a, [n, n], "a"; b, [n, m], "b"; q, [n, n], "q"; ...
+         r, [m, m], "r"; s, [n, m], "s"};
+
+  for k = 1 : rows (chk)
+    tmp = chk{k,1};
+    if (! isnumeric (tmp) || ! isreal (tmp) || ndims (tmp) > 3
+        || ! isequal (size (tmp)(1:2), chk{k,2})
+        || ! any (size (tmp, 3) == [1, horizon]))
+      error ("dlqr: %s must be a real %dx%d matrix or %dx%dx%d array", ...
+             chk{k,3}, chk{k,2}, chk{k,2}, horizon);
+    endif
+  endfor
+
+  if (! is_real_square_matrix (xf) || rows (xf) != n)
+    error ("dlqr: final weight xf must be a real %dx%d matrix", n, n);
+  endif
+
+  [g, x] = __sl_rde__ (a, b, q, r, s, xf, horizon, false);
+
+  l = eig (a(:,:,1) - b(:,:,1) * g(:,:,1));
+
+endfunction
+
+
+## finite horizon converges to the steady-state solution
+%!shared g, x, l, g_exp, x_exp, l_exp
+%! a = [0.9, 0.2; 0, 0.7];
+%! b = [0; 1];
+%! q = eye (2);
+%! r = 0.5;
+%! [g_exp, x_exp, l_exp] = dlqr (a, b, q, r);
+%! [g, x, l] = dlqr (a, b, q, r, "horizon", 200);
+%!assert (size (g), [1, 2, 200]);
+%!assert (size (x), [2, 2, 201]);
+%!assert (g(:,:,1), g_exp, 1e-8);
+%!assert (x(:,:,1), x_exp, 1e-8);
+%!assert (sort (l), sort (l_exp), 1e-8);
+
+## finite horizon with cross term and final weight against plain recursion
+%!shared g, x, g_exp, x_exp
+%! a = [1.1, 0.3; -0.2, 0.8];
+%! b = [1, 0; 0.5, 1];
+%! q = [2, 0.5; 0.5, 1];
+%! r = [1, 0.1; 0.1, 2];
+%! s = [0.1, 0; 0, 0.2];
+%! xf = [3, 1; 1, 2];
+%! N = 5;
+%! g_exp = zeros (2, 2, N);
+%! x_exp = zeros (2, 2, N+1);
+%! x_exp(:,:,N+1) = xf;
+%! for k = N : -1 : 1
+%!   p = x_exp(:,:,k+1);
+%!   g_exp(:,:,k) = (r + b'*p*b) \ (b'*p*a + s');
+%!   x_exp(:,:,k) = a'*p*a + q - (a'*p*b + s) * g_exp(:,:,k);
+%! endfor
+%! [g, x] = dlqr (a, b, q, r, s, "horizon", N, "final", xf);
+%!assert (g, g_exp, 1e-10);
+%!assert (x, x_exp, 1e-10);
+
+## time-varying problem
+%!test
+%! N = 4;
+%! a = cat (3, [1, 0.1; 0, 1], [1, 0.2; 0, 1], [1, 0.1; 0, 0.9], [0.9, 0.1; 0, 1]);
+%! b = [0; 0.1];
+%! q = eye (2);
+%! r = cat (3, 1, 2, 3, 4);
+%! x = zeros (2, 2, N+1);
+%! g = zeros (1, 2, N);
+%! for k = N : -1 : 1
+%!   p = x(:,:,k+1);
+%!   g(:,:,k) = (r(:,:,k) + b'*p*b) \ (b'*p*a(:,:,k));
+%!   x(:,:,k) = a(:,:,k)'*p*a(:,:,k) + q - a(:,:,k)'*p*b * g(:,:,k);
+%! endfor
+%! [gt, xt] = dlqr (a, b, q, r, "horizon", N);
+%!assert (gt, g, 1e-10);
+%!assert (xt, x, 1e-10);
+
+%!error <positive integer> dlqr (1, 1, 1, 1, "horizon", 0)
+%!error <descriptor> dlqr (1, 1, 1, 1, [], 2, "horizon", 3)
@@ -19,6 +19,8 @@
 ## @deftypefn{Function File} {@var{x} =} dlyap (@var{a}, @var{b})
 ## @deftypefnx{Function File} {@var{x} =} dlyap (@var{a}, @var{b}, @var{c})
 ## @deftypefnx{Function File} {@var{x} =} dlyap (@var{a}, @var{b}, @var{[]}, @var{e})
+## @deftypefnx{Function File} {@var{x} =} dlyap (@var{fa}, @var{fb}, @var{c})
+## @deftypefnx{Function File} {@var{x} =} dlyap (@var{a}, @var{b}, @var{"method"}, @var{"smith"}, @dots{})
 ## Solve discrete-time Lyapunov or Sylvester equations.
 ##
 ## @strong{Equations}
@@ -32,8 +34,34 @@
 ## @end group
 ## @end example
 ##
+## For repeated Sylvester equations with a fixed coefficient, @var{a}
+## and/or @var{b} can be replaced by a struct @var{fa} or @var{fb} with
+## fields @var{u} and @var{t} holding the real Schur factorization of the
+## coefficient, computed once by e.g. @code{[fa.u, fa.t] = schur (a)}.
+## Only the remaining coefficient is factorized on each call.
+##
+## For the Lyapunov equation, the following property/value pairs
+## select an alternative solver:
+## @table @var
+## @item "method"
+## @var{"schur"} (default) solves the equation by the Bartels-Stewart
+## method of SLICOT SB03MD.  @var{"smith"} uses the squared Smith
+## (doubling) iteration, which needs only matrix products and converges
+## for Schur stable @var{a}.  It is well suited for large models with
+## eigenvalues well inside the unit circle.
+## @item "tol"
+## Relative tolerance for the Smith iteration.  The iteration stops when
+## the Frobenius norm of the update is below @var{tol} times the norm of
+## the current iterate.  Default value is @code{n*eps}.
+## @item "maxiter"
+## Maximum number of Smith iterations.  Iteration k sums 2^k terms of the
+## series @code{x = sum (a^j*b*a'^j)}.  Default value is 50.
+## @end table
+## @var{"tol"} and @var{"maxiter"} are only accepted together with
+## @var{"method"}, @var{"smith"}.
+##
 ## @strong{Algorithm}@*
-## Uses @uref{https://github.com/SLICOT/SLICOT-Reference, SLICOT SB03MD, SB04QD and SG03AD},
+## Uses @uref{https://github.com/SLICOT/SLICOT-Reference, SLICOT SB03MD, SB04QD, SB04PD and SG03AD},
 ## Copyright (c) 2020, SLICOT, available under the BSD 3-Clause
 ## (@uref{https://github.com/SLICOT/SLICOT-Reference/blob/main/LICENSE,  License and Disclaimer}).
 ##
@@ -44,10 +72,20 @@
 ## Created: January 2010
 ## Version: 0.2.1
 
-function [x, scale] = dlyap (a, b, c, e)
+function [x, scale] = dlyap (a, b, varargin)
 
   scale = 1;
 
+  if (nargin > 2 && ischar (varargin{1}))
+    x = __dlyap_smith__ (a, b, varargin{:});
+    return;
+  elseif (nargin > 4)
+    print_usage ();
+  endif
+
+  varargin(end+1:2) = {[]};
+  [c, e] = varargin{:};
+
   switch (nargin)
     case 2                                     # Lyapunov equation
 
@@ -78,20 +116,36 @@ function [x, scale] = dlyap (a, b, c, e)
   
   
     case 3                                     # Sylvester equation
+
+      if (isstruct (a) || isstruct (b))
+
+        ## coefficients with precomputed Schur factorization
+        [ta, ua, fa] = __sylvester_coef__ (a, "a", "dlyap");
+        [tb, ub, fb] = __sylvester_coef__ (b, "b", "dlyap");
+
+        if (! is_real_matrix (c) || rows (c) != rows (ta) || columns (c) != columns (tb))
+          error ("dlyap: c must be a real (%dx%d) matrix", rows (ta), columns (tb));
+        endif
+
+        [x, scale] = __sl_sb04pd__ (ta, ua, tb, ub, -c, true, -1, fa + 2*fb);  # AXB - X = -C
+
+      else
   
-      if (! is_real_square_matrix (a, b))
-        ## error ("dlyap: a, b must be real and square");
-        error ("dlyap: %s, %s must be real and square", ...
-                inputname (1), inputname (2));
-      endif
+        if (! is_real_square_matrix (a, b))
+          ## error ("dlyap: a, b must be real and square");
+          error ("dlyap: %s, %s must be real and square", ...
+                  inputname (1), inputname (2));
+        endif
 
-      if (! is_real_matrix (c) || rows (c) != rows (a) || columns (c) != columns (b))
-        ## error ("dlyap: c must be a real (%dx%d) matrix", rows (a), columns (b));
-        error ("dlyap: %s must be a real (%dx%d) matrix", ...
-                rows (a), columns (b), inputname (3));
-      endif
+        if (! is_real_matrix (c) || rows (c) != rows (a) || columns (c) != columns (b))
+          ## error ("dlyap: c must be a real (%dx%d) matrix", rows (a), columns (b));
+          error ("dlyap: %s must be a real (%dx%d) matrix", ...
+                  rows (a), columns (b), inputname (3));
+        endif
 
-      x = __sl_sb04qd__ (-a, b, c);                 # AXB' - X = -C
+        x = __sl_sb04qd__ (-a, b, c);                 # AXB' - X = -C
+
+      endif
 
     case 4                                     # generalized Lyapunov equation
           
@@ -133,6 +187,73 @@ function [x, scale] = dlyap (a, b, c, e)
 endfunction
 
 
+function x = __dlyap_smith__ (a, b, varargin)
+
+  method = "schur";
+  tol = [];
+  maxiter = 50;
+  smithopt = false;
+
+  if (rem (numel (varargin), 2))
+    error ("dlyap: properties and values must come in pairs");
+  endif
+
+  for k = 1 : 2 : numel (varargin)
+    key = __match_key__ (varargin{k}, {"method", "tol", "maxiter"}, "dlyap");
+    val = varargin{k+1};
+    switch (key)
+      case "method"
+        method = __match_key__ (val, {"schur", "smith"}, "dlyap");
+      case "tol"
+        if (! is_real_scalar (val) || val <= 0)
+          error ("dlyap: tolerance must be a real positive scalar");
+        endif
+        tol = val;
+        smithopt = true;
+      case "maxiter"
+        if (! is_real_scalar (val) || val < 1 || fix (val) != val)
+          error ("dlyap: maxiter must be a positive integer");
+        endif
+        maxiter = val;
+        smithopt = true;
+    endswitch
+  endfor
+
+  if (smithopt && ! strcmp (method, "smith"))
+    error ("dlyap: 'tol' and 'maxiter' require method 'smith'");
+  endif
+
+  if (! is_real_square_matrix (a, b))
+    error ("dlyap: a, b must be real and square");
+  endif
+
+  if (rows (a) != rows (b))
+    error ("dlyap: a, b must have the same number of rows");
+  endif
+
+  if (strcmp (method, "schur"))
+    x = dlyap (a, b);
+    return;
+  endif
+
+  if (! issymmetric (b))
+    error ("dlyap: b must be symmetric for the Smith iteration");
+  endif
+
+  if (isempty (tol))
+    tol = max (rows (a), 1) * eps;
+  endif
+
+  [x, iter, converged] = __sl_smith__ (a, b, tol, maxiter);
+
+  if (! converged)
+    error ("dlyap: Smith iteration did not converge in %d steps, a must be stable", ...
+           iter);
+  endif
+
+endfunction
+
+
 ## Lyapunov
 %!shared X, X_exp
 %! A = [3.0   1.0   1.0
@@ -191,6 +312,43 @@ endfunction
 %!
 %!assert (X, X_exp, 1e-4);
 
+## Sylvester with factored coefficients
+%!test
+%! A = [1.0   2.0   3.0
+%!      6.0   7.0   8.0
+%!      9.0   2.0   3.0];
+%! B = [7.0   2.0   3.0
+%!      2.0   1.0   2.0
+%!      3.0   4.0   1.0];
+%! C = [271.0   135.0   147.0
+%!      923.0   494.0   482.0
+%!      578.0   383.0   287.0];
+%! X_exp = [2.0000   3.0000   6.0000
+%!          4.0000   7.0000   1.0000
+%!          5.0000   3.0000   2.0000];
+%! [fa.u, fa.t] = schur (-A);
+%! [fb.u, fb.t] = schur (B);
+%!assert (dlyap (fa, B, C), X_exp, 1e-4);
+%!assert (dlyap (-A, fb, C), X_exp, 1e-4);
+%!assert (dlyap (fa, fb, C), X_exp, 1e-4);
+
+## Lyapunov by Smith iteration
+%!shared X, X_exp
+%! A = [0.5   0.1   0.2
+%!      0.0  -0.4   0.3
+%!      0.1   0.0   0.6];
+%! B = [2.0   1.0   0.0
+%!      1.0   3.0   0.5
+%!      0.0   0.5   1.0];
+%! X_exp = dlyap (A, B);
+%! X = dlyap (A, B, "method", "smith", "tol", 1e-14);
+%!assert (X, X_exp, 1e-10);
+%!assert (A*X*A' - X + B, zeros (3), 1e-10);
+
+%!error <did not converge> dlyap (2, 1, "method", "smith")
+%!error <symmetric> dlyap ([0.1, 0; 0, 0.2], [1, 2; 3, 4], "method", "smith")
+%!error <require method 'smith'> dlyap (0.5, 1, "tol", 1e-12)
+
 ## Generalized Lyapunov
 %!shared X, X_exp
 %! A = [3.0   1.0   1.0
@@ -19,6 +19,7 @@
 ## -*- texinfo -*-
 ## @deftypefn {Function File} {@var{W} =} gram (@var{sys}, @var{mode})
 ## @deftypefnx {Function File} {@var{Wc} =} gram (@var{a}, @var{b})
+## @deftypefnx {Function File} {@var{W} =} gram (@var{sys}, @var{mode}, @var{"method"}, @var{"smith"}, @dots{})
 ## @code{gram (@var{sys}, "c")} returns the controllability gramian of
 ## the (continuous- or discrete-time) system @var{sys}.
 ## @code{gram (@var{sys}, "o")} returns the observability gramian of the
@@ -27,6 +28,11 @@
 ## @var{Wc} of the continuous-time system @math{dx/dt = a x + b u};
 ## i.e., @var{Wc} satisfies @math{a Wc + m Wc' + b b' = 0}.
 ##
+## For discrete-time systems, optional property/value pairs
+## @var{"method"}, @var{"tol"} and @var{"maxiter"} are passed to
+## @command{dlyap}.  With @var{"method"} set to @var{"smith"}, the gramian
+## is computed by the squared Smith iteration.
+##
 ## @end deftypefn
 
 ## Author: A. S. Hodel <a.s.hodel@eng.auburn.edu>
@@ -35,9 +41,9 @@
 ## Date: October 2009
 ## Version: 0.2
 
-function W = gram (argin1, argin2)
+function W = gram (argin1, argin2, varargin)
 
-  if (nargin != 2)
+  if (nargin < 2 || (! isempty (varargin) && ! ischar (argin2)))
     print_usage ();
   endif
 
@@ -70,9 +76,12 @@ function W = gram (argin1, argin2)
   endif
 
   if (isct (sys))
+    if (! isempty (varargin))
+      error ("gram: solver options are only supported for discrete-time systems");
+    endif
     W = lyap (a, b*b.');   # let lyap do the error checking about dimensions
   else  # discrete-time system
-    W = dlyap (a, b*b.');  # let dlyap do the error checking about dimensions
+    W = dlyap (a, b*b.', varargin{:});  # let dlyap do the error checking about dimensions
   endif
 
 endfunction
@@ -115,3 +124,14 @@ endfunction
 %! Ts = 0.1; ## Ts != 0
 %! Wo = gram (ss (a, b, c, d, Ts), "o");
 %! assert (a.' * Wo * a - Wo + c.' * c, zeros (size (a)), 1e-12)
+
+%!test
+%! a = [-1 0 0; 1/2 1 0; 1/2 0 -1] / 2;
+%! b = [1 0; 0 -1; 0 1];
+%! c = [0 0 1; 1 1 0];
+%! d = zeros (rows (c), columns (b));
+%! Ts = 0.1;
+%! Wc = gram (ss (a, b, c, d, Ts), "c", "method", "smith");
+%! assert (a * Wc * a.' - Wc + b * b.', zeros (size (a)), 1e-12)
+
+%!error <discrete-time> gram (ss (-1, 1, 1, 0), "c", "method", "smith")
@@ -0,0 +1,185 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @deftypefn {Function File} {@var{dat} =} iddataread (@var{file})
+## @deftypefnx {Function File} {@var{src} =} iddataread (@var{file}, @var{'map'})
+## Read a binary iddata file written by @command{iddatawrite}.
+##
+## @strong{Inputs}
+## @table @var
+## @item file
+## Name of the file.
+## @item 'map'
+## Read only the header and return a description of the data
+## instead of the signals.
+## @end table
+##
+## @strong{Outputs}
+## @table @var
+## @item dat
+## iddata set.  The signals of each experiment are read directly
+## into its matrices.
+## @item src
+## Struct array with one element per experiment and the fields
+## @var{file}, @var{offset}, @var{nsmp}, @var{outputs}, @var{inputs},
+## @var{precision}, @var{tsam}, @var{expname}, @var{outname} and @var{inname}.
+## @command{arx} accepts @var{src} in place of an iddata set,
+## @command{moesp}, @command{moen4} and @command{n4sid} accept single
+## experiments @code{src(k)} as data streams.  These functions
+## memory-map the file and work on the mapped float64 data without
+## reading it into Octave.  float32 data are converted experiment-wise
+## by @command{arx} and chunk-wise by the identification functions.
+## @end table
+##
+## @seealso{iddatawrite, iddata}
+## @end deftypefn
+
+## Created: October 2026
+## Version: 0.1
+
+function dat = iddataread (file, mode = "")
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+  endif
+
+  if (! ischar (file))
+    error ("iddataread: file name must be a string");
+  endif
+
+  if (! ischar (mode) || ! any (strcmpi (mode, {"", "map"})))
+    error ("iddataread: second argument must be 'map'");
+  endif
+
+  [fid, msg] = fopen (file, "r", "ieee-le");
+  if (fid < 0)
+    error ("iddataread: %s", msg);
+  endif
+
+  unwind_protect
+    magic = fread (fid, [1, 8], "uint8");
+    if (! isequal (magic, [double("IDDATA"), 0, 0]))
+      error ("iddataread: '%s' is not an iddata file", file);
+    endif
+
+    hdr = fread (fid, [1, 6], "uint32");
+    if (numel (hdr) != 6)
+      error ("iddataread: '%s' is truncated", file);
+    endif
+    if (hdr(1) != 1)
+      error ("iddataread: unsupported file version %d", hdr(1));
+    endif
+
+    bytes = hdr(2);
+    p = hdr(3);
+    m = hdr(4);
+    e = hdr(5);
+
+    if (bytes == 8)
+      precision = "double";
+    else
+      precision = "single";
+    endif
+
+    ns = off = zeros (e, 1);
+    tsam = cell (e, 1);
+    for k = 1 : e
+      ns(k) = fread (fid, 1, "uint64");
+      tsam{k} = fread (fid, 1, "double");
+      off(k) = fread (fid, 1, "uint64");
+    endfor
+
+    str = cell (2*p + 2*m + e + 2, 1);
+    for k = 1 : numel (str)
+      len = fread (fid, 1, "uint32");
+      str{k} = char (fread (fid, [1, len], "char"));
+    endfor
+
+    outname = str(1:p);
+    outunit = str(p+1:2*p);
+    inname = str(2*p+1:2*p+m);
+    inunit = str(2*p+m+1:2*p+2*m);
+    expname = str(2*p+2*m+1:2*p+2*m+e);
+    timeunit = str{end-1};
+    name = str{end};
+
+    if (strcmpi (mode, "map"))
+      dat = struct ("file", make_absolute_filename (file),
+                    "offset", num2cell (off), "nsmp", num2cell (ns),
+                    "outputs", p, "inputs", m, "precision", precision,
+                    "tsam", tsam, "expname", expname,
+                    "outname", {outname}, "inname", {inname});
+    else
+      y = u = cell (e, 1);
+      for k = 1 : e
+        fseek (fid, off(k), SEEK_SET);
+        y{k} = fread (fid, [ns(k), p], [precision, "=>double"]);
+        u{k} = fread (fid, [ns(k), m], [precision, "=>double"]);
+      endfor
+      if (m == 0)
+        u = {};
+      endif
+
+      dat = iddata (y, u, tsam, "outname", outname, "outunit", outunit,
+                    "inname", inname, "inunit", inunit, "expname", expname,
+                    "timeunit", timeunit, "name", name);
+    endif
+  unwind_protect_cleanup
+    fclose (fid);
+  end_unwind_protect
+
+endfunction
+
+
+%!shared DAT, FILE
+%! DAT = iddata ({[(1:10).', sin(1:10).'], [(10:-1:1).', cos(1:10).']}, ...
+%!               {(41:50).', exp(-(1:10)).'}, 0.1, "expname", {"a", "b"});
+%! FILE = tempname ();
+%!test
+%! iddatawrite (FILE, DAT);
+%! D = iddataread (FILE);
+%! unlink (FILE);
+%! assert (D.y, DAT.y);
+%! assert (D.u, DAT.u);
+%! assert (D.tsam, DAT.tsam);
+%! assert (D.expname, DAT.expname);
+%!test
+%! iddatawrite (FILE, DAT, "single");
+%! D = iddataread (FILE);
+%! S = iddataread (FILE, "map");
+%! unlink (FILE);
+%! assert (D.y, DAT.y, 1e-6);
+%! assert (size (S), [2, 1]);
+%! assert ([S.nsmp], [10, 10]);
+%! assert (S(2).precision, "single");
+%! assert (mod ([S.offset], 8), [0, 0]);
+%!test
+%! Y = {randn(200, 1), randn(150, 1)};
+%! U = {randn(200, 1), randn(150, 1)};
+%! DAT = iddata (Y, U, 1);
+%! FILE = tempname ();
+%! iddatawrite (FILE, DAT);
+%! S = iddataread (FILE, "map");
+%! SYS1 = arx (DAT, "na", 2, "nb", 2);
+%! SYS2 = arx (S, "na", 2, "nb", 2);
+%! unlink (FILE);
+%! [NUM1, DEN1] = filtdata (SYS1);
+%! [NUM2, DEN2] = filtdata (SYS2);
+%! assert (NUM2, NUM1, 1e-10);
+%! assert (DEN2, DEN1, 1e-10);
+%!error <must be 'map'> iddataread ("data.idd", "copy");
@@ -0,0 +1,132 @@
+## Copyright (C) 2026   The Octave Project Developers
+##
+## This file is part of LTI Syncope.
+##
+## LTI Syncope is free software: you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation, either version 3 of the License, or
+## (at your option) any later version.
+##
+## LTI Syncope is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @deftypefn {Function File} {} iddatawrite (@var{file}, @var{dat})
+## @deftypefnx {Function File} {} iddatawrite (@var{file}, @var{dat}, @var{precision})
+## Write time-domain dataset @var{dat} to a binary iddata file.
+## The file can be read by @command{iddataread} or memory-mapped
+## by the identification functions.
+##
+## @strong{Inputs}
+## @table @var
+## @item file
+## Name of the file.  An existing file is overwritten.
+## @item dat
+## iddata set containing signals in time-domain.
+## @item precision
+## Either @code{"double"} (default) or @code{"single"}.
+## The signals are stored as float64 or float32 values.
+## @end table
+##
+## @strong{File Format}@*
+## All numbers are little-endian.  The header consists of
+## @itemize @bullet
+## @item the 8 bytes @code{"IDDATA\0\0"},
+## @item the uint32 values version (1), bytes per value (8 or 4),
+## number of outputs p, inputs m and experiments e,
+## and the length of the header in bytes,
+## @item for every experiment the uint64 number of samples,
+## the float64 sampling time and the uint64 byte offset of its data,
+## @item the strings outname (p), outunit (p), inname (m), inunit (m),
+## expname (e), timeunit and name, each as uint32 length
+## followed by the characters.
+## @end itemize
+## The data of an experiment are the p output columns followed by the
+## m input columns, each column with all samples.
+## All offsets are multiples of 8 bytes.  Notes and userdata are not
+## stored.
+##
+## @seealso{iddataread, iddata}
+## @end deftypefn
+
+## Created: October 2026
+## Version: 0.1
+
+function iddatawrite (file, dat, precision = "double")
+
+  if (nargin < 2 || nargin > 3)
+    print_usage ();
+  endif
+
+  if (! ischar (file))
+    error ("iddatawrite: file name must be a string");
+  endif
+
+  if (! isa (dat, "iddata") || ! dat.timedomain)
+    error ("iddatawrite: second argument must be a time-domain iddata dataset");
+  endif
+
+  switch (precision)
+    case "double"
+      bytes = 8;
+    case "single"
+      bytes = 4;
+    otherwise
+      error ("iddatawrite: precision must be 'double' or 'single'");
+  endswitch
+
+  [ns, p, m, e] = size (dat);
+  y = dat.y;
+  u = dat.u;
+  tsam = dat.tsam;
+
+  timeunit = dat.timeunit;
+  if (! ischar (timeunit))
+    timeunit = "";
+  endif
+
+  str = [dat.outname(:); dat.outunit(:); dat.inname(:); dat.inunit(:);
+         dat.expname(:); {timeunit}; {dat.name}];
+
+  ## header length and data offsets, aligned to 8 bytes
+  hlen = 8 * ceil ((32 + 24*e + sum (4 + cellfun (@numel, str))) / 8);
+  len = 8 * ceil (bytes * ns(:) * (p+m) / 8);
+  off = hlen + [0; cumsum(len(1:end-1))];
+
+  [fid, msg] = fopen (file, "w", "ieee-le");
+  if (fid < 0)
+    error ("iddatawrite: %s", msg);
+  endif
+
+  unwind_protect
+    fwrite (fid, [double("IDDATA"), 0, 0], "uint8");
+    fwrite (fid, [1, bytes, p, m, e, hlen], "uint32");
+
+    for k = 1 : e
+      fwrite (fid, ns(k), "uint64");
+      fwrite (fid, tsam{k}, "double");
+      fwrite (fid, off(k), "uint64");
+    endfor
+
+    for k = 1 : numel (str)
+      fwrite (fid, numel (str{k}), "uint32");
+      fwrite (fid, str{k}, "char");
+    endfor
+
+    for k = 1 : e
+      fwrite (fid, zeros (1, off(k) - ftell (fid)), "uint8");
+      fwrite (fid, y{k}, precision);
+      if (m > 0)
+        fwrite (fid, u{k}, precision);
+      endif
+    endfor
+  unwind_protect_cleanup
+    fclose (fid);
+  end_unwind_protect
+
+endfunction
@@ -19,6 +19,7 @@
 ## @deftypefn{Function File} {@var{x} =} lyap (@var{a}, @var{b})
 ## @deftypefnx{Function File} {@var{x} =} lyap (@var{a}, @var{b}, @var{c})
 ## @deftypefnx{Function File} {@var{x} =} lyap (@var{a}, @var{b}, @var{[]}, @var{e})
+## @deftypefnx{Function File} {@var{x} =} lyap (@var{fa}, @var{fb}, @var{c})
 ## Solve continuous-time Lyapunov or Sylvester equations.
 ##
 ## @strong{Equations}
@@ -32,8 +33,23 @@
 ## @end group
 ## @end example
 ##
+## For repeated Sylvester equations with a fixed coefficient, @var{a}
+## and/or @var{b} can be replaced by a struct @var{fa} or @var{fb} with
+## fields @var{u} and @var{t} holding the real Schur factorization of the
+## coefficient, computed once by e.g. @code{[fa.u, fa.t] = schur (a)}.
+## Only the remaining coefficient is factorized on each call.
+##
+## @example
+## @group
+## [fa.u, fa.t] = schur (a);
+## for k = 1 : numel (b)
+##   x@{k@} = lyap (fa, b@{k@}, c@{k@});
+## endfor
+## @end group
+## @end example
+##
 ## @strong{Algorithm}@*
-## Uses @uref{https://github.com/SLICOT/SLICOT-Reference, SLICOT SB01SB03MD, SB04MD and SG03AD},
+## Uses @uref{https://github.com/SLICOT/SLICOT-Reference, SLICOT SB03MD, SB04MD, SB04PD and SG03AD},
 ## Copyright (c) 2020, SLICOT, available under the BSD 3-Clause
 ## (@uref{https://github.com/SLICOT/SLICOT-Reference/blob/main/LICENSE,  License and Disclaimer}).
 ##
@@ -69,20 +85,36 @@ function [x, scale] = lyap (a, b, c, e)
       ## x /= scale;                            # 0 < scale <= 1
     
     case 3                                      # Sylvester equation
+
+      if (isstruct (a) || isstruct (b))
+
+        ## coefficients with precomputed Schur factorization
+        [ta, ua, fa] = __sylvester_coef__ (a, "a", "lyap");
+        [tb, ub, fb] = __sylvester_coef__ (b, "b", "lyap");
+
+        if (! is_real_matrix (c) || rows (c) != rows (ta) || columns (c) != columns (tb))
+          error ("lyap: c must be a real (%dx%d) matrix", rows (ta), columns (tb));
+        endif
+
+        [x, scale] = __sl_sb04pd__ (ta, ua, tb, ub, -c, false, 1, fa + 2*fb);  # AX + XB = -C
+
+      else
     
-      if (! is_real_square_matrix (a, b))
-        ## error ("lyap: a, b must be real and square");
-        error ("lyap: %s, %s must be real and square", ...
-                inputname (1), inputname (2));
-      endif
+        if (! is_real_square_matrix (a, b))
+          ## error ("lyap: a, b must be real and square");
+          error ("lyap: %s, %s must be real and square", ...
+                  inputname (1), inputname (2));
+        endif
 
-      if (! is_real_matrix (c) || rows (c) != rows (a) || columns (c) != columns (b))
-        ## error ("lyap: c must be a real (%dx%d) matrix", rows (a), columns (b));
-        error ("lyap: %s must be a real (%dx%d) matrix", ...
-                rows (a), columns (b), inputname (3));
-      endif
+        if (! is_real_matrix (c) || rows (c) != rows (a) || columns (c) != columns (b))
+          ## error ("lyap: c must be a real (%dx%d) matrix", rows (a), columns (b));
+          error ("lyap: %s must be a real (%dx%d) matrix", ...
+                  rows (a), columns (b), inputname (3));
+        endif
 
-      x = __sl_sb04md__ (a, b, -c);  # AX + XB = -C
+        x = __sl_sb04md__ (a, b, -c);  # AX + XB = -C
+
+      endif
 
     case 4                                      # generalized Lyapunov equation
     
@@ -154,6 +186,26 @@ endfunction
 %!
 %!assert (X, X_exp, 1e-4);
 
+## Sylvester with factored coefficients
+%!test
+%! A = [2.0   1.0   3.0
+%!      0.0   2.0   1.0
+%!      6.0   1.0   2.0];
+%! B = [2.0   1.0
+%!      1.0   6.0];
+%! C = [2.0   1.0
+%!      1.0   4.0
+%!      0.0   5.0];
+%! X_exp = lyap (A, B, -C);
+%! [fa.u, fa.t] = schur (A);
+%! [fb.u, fb.t] = schur (B);
+%!assert (lyap (fa, B, -C), X_exp, 1e-10);
+%!assert (lyap (A, fb, -C), X_exp, 1e-10);
+%!assert (lyap (fa, fb, -C), X_exp, 1e-10);
+
+%!error <fields> lyap (struct ("t", 1), 1, 1)
+%!error <Schur form> lyap (struct ("u", eye (3), "t", magic (3)), 1, ones (3, 1))
+
 ## Generalized Lyapunov
 %!shared X, X_exp
 %! A = [  3.0     1.0     1.0
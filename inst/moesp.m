@@ -29,10 +29,25 @@
 ## @table @var
 ## @item dat
 ## iddata set containing the measurements, i.e. time-domain signals.
+## Alternatively, a data stream of a single long record which is never
+## held in memory as a whole.  Either a function handle with
+## @code{[y, u] = dat (k)} returning the k-th chunk of samples
+## (row-wise, empty @var{y} after the last chunk), or a struct with
+## fields @var{file}, @var{offset} (in bytes, default 0), @var{nsmp},
+## @var{outputs} and @var{inputs} describing a binary file of float64
+## values, the columns of y followed by the columns of u, each of length
+## @var{nsmp}.  The file is memory-mapped and processed in chunks.
+## An experiment @code{src(k)} of @code{src = iddataread (file, "map")}
+## is such a struct for files written by @command{iddatawrite}.
+## Data streams require the order @var{n} or the key @var{s}.
 ## @item n
 ## The desired order of the resulting state-space system @var{sys}.
 ## If not specified, @var{n} is chosen automatically according
 ## to the singular values and tolerances.
+## If @var{n} is a vector of orders, the data are compressed once
+## and a model is estimated for every order, in parallel threads.
+## Then @var{sys} and @var{x0} are cell vectors and @var{info} is a
+## struct array with one element per order.
 ## @item @dots{}
 ## Optional pairs of keys and values.  @code{'key1', value1, 'key2', value2}.
 ## @item opt
@@ -63,6 +78,11 @@
 ## State-output cross-covariance matrix.
 ## @item info.L
 ## Noise variance matrix factor. LL'=Ry.
+## @item info.factor
+## Compressed data, i.e. the triangular factor of the block Hankel
+## matrices together with the singular values @var{info.factor.sv} and
+## the order estimate @var{info.factor.n}.  Pass it by key 'factor' to
+## estimate models of other orders without processing the data again.
 ## @end table
 ## @end table
 ##
@@ -214,6 +234,49 @@
 ## @end example
 ## @end ifnottex
 ## @end table
+##
+## @item 'factor'
+## Field @var{info.factor} of an earlier identification with the same
+## method, key 's' and dataset.  Only the model estimation is repeated
+## for the requested order @var{n}.  The dataset @var{dat} is only
+## used for the initial state @var{x0}; it may be empty, [], in which
+## case @var{x0} is empty as well.
+##
+## @item 'threads'
+## Number of threads for the data compression of multi-experiment
+## datasets.  For values other than 1, the triangular factor of every
+## experiment is computed in its own thread by a tall-skinny QR and the
+## factors are combined in a reduction tree; 0 uses all processor
+## cores.  This is a variant of the QR algorithm, option 'alg' must be
+## omitted or 'qr' then.  Default value is 1.
+## For a vector of orders @var{n}, also the number of threads for the
+## model estimation.  Default value is 0 (all cores) in this case.
+##
+## @item 'window'
+## Recursive identification of a single-experiment dataset.  Only the
+## last @var{window} samples are used, Inf uses all samples.  The
+## triangular factor of the data is returned in @var{info.factor}
+## together with the samples needed for later updates.
+##
+## @item 'update'
+## If true, the samples of @var{dat} are appended to the recursive
+## identification given by key 'factor'.  New block Hankel rows are
+## added to the factor by a QR update, rows of samples which leave the
+## window are removed by a Givens downdate.  The cost depends on the
+## number of new samples, not on the window length.  Default value
+## is false.
+##
+## @item 'workspace'
+## Memory budget in MiB for the workspace of the SLICOT routines beyond
+## the required minimum.  With more workspace, the QR factorizations of
+## the data work on larger blocks, which is faster for long datasets.
+## 0 means no limit.  Default value is 256.
+##
+## @item 'tsam'
+## Sampling time of a data stream.  Default value is -1 (unspecified).
+##
+## @item 'chunk'
+## Number of samples per chunk of a data file.  Default value is 65536.
 ## @end table
 ##
 ##
@@ -241,3 +304,92 @@ function [sys, x0, info] = moesp (varargin)
   endif
 
 endfunction
+
+
+## data stream from a function handle against an iddata set
+%!test
+%! sys = ss ([0.5, 0.2; -0.2, 0.6], [1; 0.5], [1, 0], 0, 1);
+%! u = sin ((1:1200).' / 7) + cos ((1:1200).' / 3);
+%! y = lsim (sys, u);
+%! src = @(k) deal (y((k-1)*300+1 : min (k*300, end), :), u((k-1)*300+1 : min (k*300, end), :));
+%! sysi = moesp (iddata (y, u, 1), 2, "s", 10);
+%! syss = moesp (src, 2, "s", 10, "tsam", 1);
+%! assert (syss.tsam, 1);
+%! Hi = impulse (sysi, 20);
+%! Hs = impulse (syss, 20);
+%! assert (Hs, Hi, 1e-6);
+
+## parallel TSQR compression of multi-experiment data
+%!test
+%! sys = ss ([0.5, 0.2; -0.2, 0.6], [1; 0.5], [1, 0], 0, 1);
+%! dat = cell (4, 1);
+%! for i = 1:4
+%!   u = sin ((1:400).' / (3+i)) + cos ((1:400).' * i / 5);
+%!   dat{i} = iddata (lsim (sys, u), u, 1);
+%! endfor
+%! dat = merge (dat{:});
+%! [sysi, x0i] = moesp (dat, 2, "s", 8, "alg", "q");
+%! [syst, x0t] = moesp (dat, 2, "s", 8, "threads", 2);
+%! assert (numel (x0t), 4);
+%! assert (impulse (syst, 20), impulse (sysi, 20), 1e-6);
+%! syst = moesp (dat, 2, "s", 8, "threads", 2, "alg", "q");
+%! assert (impulse (syst, 20), impulse (sysi, 20), 1e-6);
+%! fail ('moesp (dat, 2, "s", 8, "threads", 2, "alg", "c")', "'alg' must be 'qr'");
+
+## sliding-window identification by factor updates
+%!test
+%! sys = ss ([0.5, 0.2, 0; -0.2, 0.6, 0; 0, 0, -0.3], [1; 0.5; 1], [1, 0, 1], 0, 1);
+%! u = sin ((1:900).' / 7) + cos ((1:900).' / 3) + sin ((1:900).' / 2);
+%! y = lsim (sys, u);
+%! [~, ~, info] = moesp (iddata (y(1:500), u(1:500), 1), 3, "s", 8, "window", 400);
+%! [sysw, ~, info] = moesp (iddata (y(501:650), u(501:650), 1), 3, "factor", info.factor, "update", true);
+%! [sysw, ~, info] = moesp (iddata (y(651:900), u(651:900), 1), 3, "factor", info.factor, "update", true);
+%! sysd = moesp (iddata (y(501:900), u(501:900), 1), 3, "s", 8, "alg", "q");
+%! assert (rows (info.factor.y), 400);
+%! assert (impulse (sysw, 20), impulse (sysd, 20), 1e-6);
+
+%!error <recursive identification> moesp (merge (iddata (rand (100, 1), rand (100, 1)), iddata (rand (100, 1), rand (100, 1))), 2, "window", 50)
+
+## reuse of the stored factor for other orders
+%!test
+%! sys = ss ([0.5, 0.2, 0; -0.2, 0.6, 0; 0, 0, -0.3], [1; 0.5; 1], [1, 0, 1], 0, 1);
+%! u = sin ((1:800).' / 7) + cos ((1:800).' / 3) + sin ((1:800).' / 2);
+%! dat = iddata (lsim (sys, u), u, 1);
+%! [~, ~, info] = moesp (dat, 2, "s", 8);
+%! [sys3, x03] = moesp (dat, 3, "s", 8);
+%! [sysf, x0f] = moesp (dat, 3, "factor", info.factor);
+%! sysn = moesp ([], 3, "factor", info.factor);
+%! assert (info.factor.nobr, 8);
+%! assert (impulse (sysf, 20), impulse (sys3, 20), 1e-8);
+%! assert (impulse (sysn, 20), impulse (sys3, 20), 1e-8);
+%! assert (x0f, x03, 1e-8);
+%! assert (sysn.tsam, 1);
+
+## several orders from a single decomposition
+%!test
+%! sys = ss ([0.5, 0.2, 0; -0.2, 0.6, 0; 0, 0, -0.3], [1; 0.5; 1], [1, 0, 1], 0, 1);
+%! u = sin ((1:800).' / 7) + cos ((1:800).' / 3) + sin ((1:800).' / 2);
+%! dat = iddata (lsim (sys, u), u, 1);
+%! [sysv, x0v, infov] = moesp (dat, [2, 3, 4], "s", 8);
+%! assert (size (sysv), [1, 3]);
+%! assert (cellfun (@(x) size (x.a, 1), sysv), [2, 3, 4]);
+%! for i = 1 : 3
+%!   [sysi, x0i, infoi] = moesp (dat, i+1, "s", 8);
+%!   assert (impulse (sysv{i}, 20), impulse (sysi, 20), 1e-8);
+%!   assert (x0v{i}, x0i, 1e-8);
+%!   assert (infov(i).K, infoi.K, 1e-8);
+%! endfor
+
+## minimal and unlimited workspace give the same model
+%!test
+%! sys = ss ([0.5, 0.2, 0; -0.2, 0.6, 0; 0, 0, -0.3], [1; 0.5; 1], [1, 0, 1], 0, 1);
+%! u = sin ((1:800).' / 7) + cos ((1:800).' / 3) + sin ((1:800).' / 2);
+%! dat = iddata (lsim (sys, u), u, 1);
+%! sys1 = moesp (dat, 3, "s", 8, "alg", "q", "workspace", 1e-3);
+%! sys2 = moesp (dat, 3, "s", 8, "alg", "q", "workspace", 0);
+%! assert (impulse (sys1, 20), impulse (sys2, 20), 1e-8);
+
+%!error <vector of positive integers> moesp (iddata (rand (100, 1), rand (100, 1)), [2, 0])
+%!error <computed for s = 8> moesp ([], 3, "s", 9, "factor", struct ("r", 1, "nobr", 8, "meth", 0, "p", 1, "m", 1, "tsam", 1))
+
+%!error <order 'n' or the upper bound 's'> moesp (@(k) [], "tsam", 1)
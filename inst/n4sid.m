@@ -29,10 +29,25 @@
 ## @table @var
 ## @item dat
 ## iddata set containing the measurements, i.e. time-domain signals.
+## Alternatively, a data stream of a single long record which is never
+## held in memory as a whole.  Either a function handle with
+## @code{[y, u] = dat (k)} returning the k-th chunk of samples
+## (row-wise, empty @var{y} after the last chunk), or a struct with
+## fields @var{file}, @var{offset} (in bytes, default 0), @var{nsmp},
+## @var{outputs} and @var{inputs} describing a binary file of float64
+## values, the columns of y followed by the columns of u, each of length
+## @var{nsmp}.  The file is memory-mapped and processed in chunks.
+## An experiment @code{src(k)} of @code{src = iddataread (file, "map")}
+## is such a struct for files written by @command{iddatawrite}.
+## Data streams require the order @var{n} or the key @var{s}.
 ## @item n
 ## The desired order of the resulting state-space system @var{sys}.
 ## If not specified, @var{n} is chosen automatically according
 ## to the singular values and tolerances.
+## If @var{n} is a vector of orders, the data are compressed once
+## and a model is estimated for every order, in parallel threads.
+## Then @var{sys} and @var{x0} are cell vectors and @var{info} is a
+## struct array with one element per order.
 ## @item @dots{}
 ## Optional pairs of keys and values.  @code{'key1', value1, 'key2', value2}.
 ## @item opt
@@ -63,6 +78,11 @@
 ## State-output cross-covariance matrix.
 ## @item info.L
 ## Noise variance matrix factor. LL'=Ry.
+## @item info.factor
+## Compressed data, i.e. the triangular factor of the block Hankel
+## matrices together with the singular values @var{info.factor.sv} and
+## the order estimate @var{info.factor.n}.  Pass it by key 'factor' to
+## estimate models of other orders without processing the data again.
 ## @end table
 ## @end table
 ##
@@ -214,6 +234,49 @@
 ## @end example
 ## @end ifnottex
 ## @end table
+##
+## @item 'factor'
+## Field @var{info.factor} of an earlier identification with the same
+## method, key 's' and dataset.  Only the model estimation is repeated
+## for the requested order @var{n}.  The dataset @var{dat} is only
+## used for the initial state @var{x0}; it may be empty, [], in which
+## case @var{x0} is empty as well.
+##
+## @item 'threads'
+## Number of threads for the data compression of multi-experiment
+## datasets.  For values other than 1, the triangular factor of every
+## experiment is computed in its own thread by a tall-skinny QR and the
+## factors are combined in a reduction tree; 0 uses all processor
+## cores.  This is a variant of the QR algorithm, option 'alg' must be
+## omitted or 'qr' then.  Default value is 1.
+## For a vector of orders @var{n}, also the number of threads for the
+## model estimation.  Default value is 0 (all cores) in this case.
+##
+## @item 'window'
+## Recursive identification of a single-experiment dataset.  Only the
+## last @var{window} samples are used, Inf uses all samples.  The
+## triangular factor of the data is returned in @var{info.factor}
+## together with the samples needed for later updates.
+##
+## @item 'update'
+## If true, the samples of @var{dat} are appended to the recursive
+## identification given by key 'factor'.  New block Hankel rows are
+## added to the factor by a QR update, rows of samples which leave the
+## window are removed by a Givens downdate.  The cost depends on the
+## number of new samples, not on the window length.  Default value
+## is false.
+##
+## @item 'workspace'
+## Memory budget in MiB for the workspace of the SLICOT routines beyond
+## the required minimum.  With more workspace, the QR factorizations of
+## the data work on larger blocks, which is faster for long datasets.
+## 0 means no limit.  Default value is 256.
+##
+## @item 'tsam'
+## Sampling time of a data stream.  Default value is -1 (unspecified).
+##
+## @item 'chunk'
+## Number of samples per chunk of a data file.  Default value is 65536.
 ## @end table
 ##
 ##
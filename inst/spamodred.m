@@ -106,8 +106,36 @@
 ## Use the square-root Singular Perturbation Approximation method.
 ## @item 'bfsr', 'p'
 ## Use the balancing-free square-root Singular Perturbation Approximation method.  Default method.
+## @item 'lr', 'lowrank'
+## Use a low-rank method for large models.  The Gramians are not formed,
+## instead low-rank factors are computed by the ADI iteration and the
+## leading Hankel singular values by a (randomized) SVD of the product
+## of these factors.  The system must be stable, frequency weightings
+## are not supported and option 'alpha' is ignored.
+## The reduced model is obtained by singular perturbation of the
+## balanced realization of the numerically minimal part.
 ## @end table
 ##
+## @item 'adi-tol'
+## Relative residual tolerance of the low-rank ADI iteration.
+## Only used with method 'lowrank'.  Default value is 1e-10.
+##
+## @item 'adi-maxiter'
+## Maximum number of low-rank ADI steps.
+## Only used with method 'lowrank'.  Default value is 100.
+##
+## @item 'frequency-band'
+## Frequency interval [w1, w2] in rad/s, 0 <= w1 < w2 <= Inf, of special
+## interest.  The frequency-limited Gramians of this band replace the
+## ordinary ones, such that the approximation error is small inside the
+## band.  The stability of @var{Gr} is not guaranteed.
+##
+## @item 'time-interval'
+## Time interval [t1, t2], 0 <= t1 < t2 <= Inf, of special interest.
+## The time-limited Gramians of this interval replace the ordinary ones.
+## For finite t2, unstable models are admissible.  The stability of
+## @var{Gr} is not guaranteed.
+##
 ## @item 'alpha'
 ## Specifies the ALPHA-stability boundary for the eigenvalues
 ## of the state dynamics matrix @var{G.A}.  For a continuous-time
@@ -231,3 +259,38 @@ function [Gr, info] = spamodred (varargin)
 endfunction
 
 ## TODO: add a test
+
+## low-rank method against dense Gramians
+%!test
+%! n = 40;
+%! a = diag (-(1:n)) + diag (0.5*ones (n-1, 1), 1);
+%! b = [ones(n, 1), (1:n).'/n];
+%! c = [1, zeros(1, n-1); (-1).^(1:n)];
+%! d = zeros (2);
+%! G = ss (a, b, c, d);
+%! [Gr, info] = spamodred (G, 6, "scale", false);
+%! [Grl, infol] = spamodred (G, 6, "method", "lowrank");
+%! assert (infol.nr, 6);
+%! assert (infol.hsv(1:6), info.hsv(1:6), 1e-6*info.hsv(1));
+%! w = logspace (-2, 2, 30);
+%! H = freqresp (Gr, w);
+%! Hl = freqresp (Grl, w);
+%! assert (Hl, H, 1e-6*max (abs (H(:))));
+
+%!test
+%! a = [0.5, 0.2, 0; 0, -0.3, 0.1; 0, 0, 0.1];
+%! G = ss (a, [1; 0; 1], [1, 1, 0], 0, 1);
+%! [~, info] = spamodred (G, 2, "scale", false);
+%! [~, infol] = spamodred (G, 2, "method", "lowrank");
+%! assert (infol.hsv(1:2), info.hsv(1:2), 1e-6*info.hsv(1));
+
+%!error <stable> spamodred (ss (1, 1, 1, 0), 1, "method", "lowrank")
+
+## time-limited Gramians of an unstable model
+%!test
+%! a = [0.1, 1, 0; 0, -1, 1; 0, 0, -2];
+%! G = ss (a, [0; 0; 1], [1, 0, 0], 0);
+%! [~, info] = spamodred (G, 2, "time-interval", [0, 2]);
+%! [~, infob] = btamodred (G, 2, "time-interval", [0, 2]);
+%! assert (info.nr, 2);
+%! assert (info.hsv, infob.hsv, 1e-12);
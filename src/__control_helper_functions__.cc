@@ -5,6 +5,8 @@
 #include "is_matrix.cc"
 #include "is_zp_vector.cc"
 #include "lti_input_idx.cc"
+#include "lti_validate.cc"
+#include "cpu_features.cc"
 
 
 // stub function to avoid gen_doc_cache warning upon package installation
@@ -0,0 +1,23 @@
+#include "sl_ident.cc"   // system identification
+#include "sl_ib01ad.cc"  // compute singular values
+#include "sl_ib01bd.cc"  // estimate system matrices from the triangular factor R
+#include "sl_ib01cd.cc"  // compute initial state vector
+#include "sl_ident_stream.cc"  // out-of-core data compression for system identification
+#include "sl_ident_factor.cc"  // common parts of the TSQR and recursive data compression
+#include "sl_ident_tsqr.cc"    // parallel data compression of multi-experiment datasets
+#include "sl_ident_update.cc"  // recursive and sliding-window data compression
+#include "sl_arx.cc"     // covariance matrices of ARX regression problems
+#include "sl_iddata_pipeline.cc"  // preprocessing pipeline for iddata sets
+#include "control_state.cc"    // workspace arena and profiling of this oct-file
+
+
+// stub function to avoid gen_doc_cache warning upon package installation,
+// also gives access to the state of this oct-file
+DEFUN_DLD (__control_slicot_ident__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot Release 5.0, system identification\n\
+No argument checking.\n\
+For internal use only.")
+{
+    return control_state ("__control_slicot_ident__", args);
+}
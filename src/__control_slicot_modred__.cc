@@ -0,0 +1,20 @@
+#include "sl_ab13ad.cc"  // Hankel singular values
+#include "sl_ab09hd.cc"  // balanced stochastic truncation model reduction
+#include "sl_ab09id.cc"  // balanced truncation & singular perturbation approximation model reduction
+#include "sl_ab09jd.cc"  // Hankel-norm approximation model reduction
+#include "sl_sb16ad.cc"  // balanced truncation & singular perturbation approximation controller reduction
+#include "sl_sb16bd.cc"  // coprime factorization state-feedback controller reduction
+#include "sl_sb16cd.cc"  // frequency-weighted coprime factorization state-feedback controller reduction
+#include "control_state.cc"    // workspace arena and profiling of this oct-file
+
+
+// stub function to avoid gen_doc_cache warning upon package installation,
+// also gives access to the state of this oct-file
+DEFUN_DLD (__control_slicot_modred__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot Release 5.0, model and controller reduction\n\
+No argument checking.\n\
+For internal use only.")
+{
+    return control_state ("__control_slicot_modred__", args);
+}
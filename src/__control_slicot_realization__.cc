@@ -0,0 +1,32 @@
+#include "sl_ab01od.cc"  // staircase form using orthogonal transformations
+#include "sl_ab04md.cc"  // bilinear transformation
+#include "sl_ab08nd.cc"  // invariant zeros of state-space models
+#include "sl_ab13bd.cc"  // H-2 norm
+#include "sl_ab13dd.cc"  // L-infinity norm
+#include "sl_ag08bd.cc"  // finite Smith zeros of descriptor state-space models
+#include "sl_mb05nd.cc"  // matrix exponential and integral for a real matrix
+#include "sl_sb10jd.cc"  // descriptor to regular state-space conversion
+#include "sl_tb01id.cc"  // scaling of state-space models
+#include "sl_tb01pd.cc"  // minimal realization of state-space models
+#include "sl_tb01ud.cc"  // controllable block Hessenberg realization
+#include "sl_tb04bd.cc"  // state-space to transfer function conversion
+#include "sl_td04ad.cc"  // transfer function to state-space conversion
+#include "sl_tg01ad.cc"  // scaling of descriptor state-space models
+#include "sl_tg01fd.cc"  // orthogonal reduction of dss to a SVD-like coordinate form
+#include "sl_tg01hd.cc"  // controllability staircase form of descriptor state-space models
+#include "sl_tg01id.cc"  // observability staircase form of descriptor state-space models
+#include "sl_tg01jd.cc"  // minimal realization of descriptor state-space models
+#include "sl_tg04bx.cc"  // gain of descriptor state-space models
+#include "control_state.cc"    // workspace arena and profiling of this oct-file
+
+
+// stub function to avoid gen_doc_cache warning upon package installation,
+// also gives access to the state of this oct-file
+DEFUN_DLD (__control_slicot_realization__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot Release 5.0, realization, transformation and analysis of state-space models\n\
+No argument checking.\n\
+For internal use only.")
+{
+    return control_state ("__control_slicot_realization__", args);
+}
@@ -0,0 +1,25 @@
+#include "sl_sb02od.cc"  // algebraic Riccati equations
+#include "sl_sg02ad.cc"  // solution of algebraic Riccati equations for descriptor systems
+// #include "sl_are.cc"     // solve ARE with Schur vector approach and scaling
+#include "sl_rde.cc"     // finite-horizon discrete-time Riccati difference equations
+#include "sl_sb03md.cc"  // Lyapunov equations
+#include "sl_sb03od.cc"  // Cholesky factor of Lyapunov equations
+#include "sl_sg03ad.cc"  // generalized Lyapunov equations
+#include "sl_sg03bd.cc"  // Cholesky factor of generalized Lyapunov equations
+#include "sl_smith.cc"   // squared Smith iteration for discrete-time Lyapunov equations
+#include "sl_sb04md.cc"  // Sylvester equations - continuous-time
+#include "sl_sb04qd.cc"  // Sylvester equations - discrete-time
+#include "sl_sb04pd.cc"  // Sylvester equations with precomputed Schur factorizations
+#include "control_state.cc"    // workspace arena and profiling of this oct-file
+
+
+// stub function to avoid gen_doc_cache warning upon package installation,
+// also gives access to the state of this oct-file
+DEFUN_DLD (__control_slicot_riccati__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot Release 5.0, Riccati, Lyapunov and Sylvester equations\n\
+No argument checking.\n\
+For internal use only.")
+{
+    return control_state ("__control_slicot_riccati__", args);
+}
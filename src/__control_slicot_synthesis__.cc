@@ -0,0 +1,23 @@
+#include "sl_sb01bd.cc"  // pole assignment
+#include "sl_sb10hd.cc"  // H-2 controller synthesis - continuous-time
+#include "sl_sb10ed.cc"  // H-2 controller synthesis - discrete-time
+#include "sl_sb10fd.cc"  // H-infinity controller synthesis - continuous-time
+#include "sl_sb10dd.cc"  // H-infinity controller synthesis - discrete-time
+#include "sl_sb10ad.cc"  // H-infinity optimal controller using modified Glover's and Doyle's formulas (continuous-time)
+#include "sl_sb10id.cc"  // H-infinity loop shaping - continuous-time
+#include "sl_sb10kd.cc"  // H-infinity loop shaping - discrete-time - strictly proper case
+#include "sl_sb10zd.cc"  // H-infinity loop shaping - discrete-time - proper case
+#include "sl_sb10yd.cc"  // fit state-space model to frequency response data
+#include "control_state.cc"    // workspace arena and profiling of this oct-file
+
+
+// stub function to avoid gen_doc_cache warning upon package installation,
+// also gives access to the state of this oct-file
+DEFUN_DLD (__control_slicot_synthesis__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot Release 5.0, controller synthesis\n\
+No argument checking.\n\
+For internal use only.")
+{
+    return control_state ("__control_slicot_synthesis__", args);
+}
@@ -21,16 +21,45 @@ Common code for oct-files.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: April 2010
-Version: 0.4
+Version: 0.13
 
 */
 
 
 #include <sstream>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <exception>
+#include <limits>
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+#include <map>
+#include <mutex>
 #include <octave/oct.h>
+#include <octave/Cell.h>
+
+#if ! defined (_WIN32)
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include "common.h"
 
+extern "C"
+{
+    int F77_FUNC (dgeqrf, DGEQRF)
+                 (F77_INT& M, F77_INT& N,
+                  double* A, F77_INT& LDA,
+                  double* TAU,
+                  double* WORK, F77_INT& LWORK,
+                  F77_INT& INFO);
+}
+
 F77_INT max (F77_INT a, F77_INT b)
 {
     if (a > b)
@@ -110,3 +139,629 @@ void warning_msg (const char name[], octave_idx_type index, octave_idx_type max,
 
     warning ("%s", os.str ().c_str ());
 }
+
+F77_INT control_workspace (double lmin, double lopt, double budget)
+{
+    double len = lopt;
+
+    if (budget > 0 && len * sizeof (double) > budget)
+        len = std::floor (budget / sizeof (double));
+
+    if (len < lmin)
+        len = lmin;
+
+    // LDWORK is passed as F77_INT, too small values are reported
+    // by the SLICOT routine as invalid argument
+    const double lmax = std::numeric_limits<F77_INT>::max ();
+
+    if (len > lmax)
+        len = lmax;
+
+    return static_cast<F77_INT> (len);
+}
+
+// default budget of the optimal workspace, 256 MiB
+static std::atomic<double> control_ldwork_max (256.0 * 1024 * 1024);
+
+static std::mutex control_ldwork_mutex;
+static std::map<std::pair<std::string, std::vector<F77_INT>>, double> control_ldwork_cache;
+
+F77_INT control_block_size ()
+{
+    static std::atomic<F77_INT> nb (0);
+
+    if (nb == 0)
+    {
+        // DGEQRF returns n*NB for large n
+        F77_INT n = 1024;
+        F77_INT lwork = -1;
+        F77_INT info;
+        double a, tau, wquery;
+
+        F77_FUNC (dgeqrf, DGEQRF) (n, n, &a, n, &tau, &wquery, lwork, info);
+
+        F77_INT k = (info == 0) ? static_cast<F77_INT> (wquery) / n : 32;
+        nb = max (1, k);
+    }
+
+    return nb;
+}
+
+F77_INT control_ldwork (const std::string& routine, const std::vector<F77_INT>& dims,
+                        double lmin, double ncol,
+                        const std::function<double ()>& query)
+{
+    auto key = std::make_pair (routine, dims);
+    double lopt = -1;
+
+    {
+        std::lock_guard<std::mutex> lock (control_ldwork_mutex);
+        auto it = control_ldwork_cache.find (key);
+
+        if (it != control_ldwork_cache.end ())
+            lopt = it->second;
+    }
+
+    if (lopt < 0)
+    {
+        if (query)
+            lopt = query ();
+        else
+            lopt = lmin + ncol * control_block_size ();
+
+        std::lock_guard<std::mutex> lock (control_ldwork_mutex);
+
+        // dimension sweeps must not grow the cache without bound
+        if (control_ldwork_cache.size () >= 4096)
+            control_ldwork_cache.clear ();
+
+        control_ldwork_cache[key] = lopt;
+    }
+
+    return control_workspace (lmin, lopt, control_ldwork_max.load ());
+}
+
+double control_ldwork_budget (double bytes)
+{
+    if (bytes < 0)
+        return control_ldwork_max.load ();
+
+    return control_ldwork_max.exchange (bytes);
+}
+
+int control_threads (int nthreads)
+{
+    // nthreads <= 0:  one thread per core
+    if (nthreads <= 0)
+        nthreads = static_cast<int> (std::thread::hardware_concurrency ());
+
+    return (nthreads < 1) ? 1 : nthreads;
+}
+
+struct control_blas_api
+{
+    std::string name;
+    std::function<int ()> get;
+    std::function<void (int)> set;
+};
+
+template <typename T>
+static T control_blas_symbol (const char* name)
+{
+#if ! defined (_WIN32)
+    return reinterpret_cast<T> (dlsym (RTLD_DEFAULT, name));
+#else
+    (void) name;
+    return nullptr;
+#endif
+}
+
+static control_blas_api control_blas_detect ()
+{
+    typedef int (*get_int) ();
+    typedef void (*set_int) (int);
+    typedef long long (*get_dim) ();      // dim_t of BLIS
+    typedef void (*set_dim) (long long);
+
+    control_blas_api api;
+
+    // FlexiBLAS forwards to its backend and comes first
+    get_int flexiblas_get = control_blas_symbol<get_int> ("flexiblas_get_num_threads");
+    set_int flexiblas_set = control_blas_symbol<set_int> ("flexiblas_set_num_threads");
+    get_int openblas_get = control_blas_symbol<get_int> ("openblas_get_num_threads");
+    set_int openblas_set = control_blas_symbol<set_int> ("openblas_set_num_threads");
+    get_int mkl_get = control_blas_symbol<get_int> ("MKL_Get_Max_Threads");
+    set_int mkl_set = control_blas_symbol<set_int> ("MKL_Set_Num_Threads");
+    get_dim blis_get = control_blas_symbol<get_dim> ("bli_thread_get_num_threads");
+    set_dim blis_set = control_blas_symbol<set_dim> ("bli_thread_set_num_threads");
+
+    if (flexiblas_get && flexiblas_set)
+        api = {"FlexiBLAS", flexiblas_get, flexiblas_set};
+    else if (openblas_get && openblas_set)
+        api = {"OpenBLAS", openblas_get, openblas_set};
+    else if (mkl_get && mkl_set)
+        api = {"MKL", mkl_get, mkl_set};
+    else if (blis_get && blis_set)
+        api = {"BLIS",
+               [=] () { return static_cast<int> (blis_get ()); },
+               [=] (int k) { blis_set (k); }};
+    else
+        api.name = "unknown";
+
+    return api;
+}
+
+static const control_blas_api& control_blas ()
+{
+    static const control_blas_api api = control_blas_detect ();
+    return api;
+}
+
+std::string control_blas_backend ()
+{
+    return control_blas ().name;
+}
+
+int control_blas_threads (int nthreads)
+{
+    const control_blas_api& api = control_blas ();
+
+    if (! api.get)
+        return 0;
+
+    // BLIS reports -1 unless set by the API
+    int old = std::max (api.get (), 1);
+
+    if (nthreads >= 1 && nthreads != old)
+        api.set (nthreads);
+
+    return old;
+}
+
+// one BLAS thread per worker of parallel_for, restored afterwards
+class control_blas_serial
+{
+public:
+    control_blas_serial () : m_old (control_blas_threads (1)) { }
+
+    ~control_blas_serial ()
+    {
+        if (m_old > 1)
+            control_blas_threads (m_old);
+    }
+
+private:
+    control_blas_serial (const control_blas_serial&) = delete;
+    control_blas_serial& operator = (const control_blas_serial&) = delete;
+
+    int m_old;
+};
+
+void parallel_for (octave_idx_type n, int nthreads,
+                   const std::function<void (octave_idx_type)>& fcn)
+{
+    nthreads = control_threads (nthreads);
+
+    if (nthreads > n)
+        nthreads = static_cast<int> (n);
+
+    if (nthreads <= 1)
+    {
+        for (octave_idx_type i = 0; i < n; i++)
+            fcn (i);
+
+        return;
+    }
+
+    control_blas_serial blas_serial;
+
+    std::atomic<octave_idx_type> next (0);
+    std::exception_ptr eptr = nullptr;
+    std::atomic<bool> failed (false);
+
+    auto worker = [&] ()
+    {
+        octave_idx_type i;
+
+        while (! failed && (i = next++) < n)
+        {
+            try
+            {
+                fcn (i);
+            }
+            catch (...)
+            {
+                if (! failed.exchange (true))
+                    eptr = std::current_exception ();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+
+    for (int t = 1; t < nthreads; t++)
+        pool.emplace_back (worker);
+
+    worker ();
+
+    for (auto& th : pool)
+        th.join ();
+
+    if (eptr)
+        std::rethrow_exception (eptr);
+}
+
+control_mapped_file::control_mapped_file (const std::string& file,
+                                          double offset, double len,
+                                          bool sequential)
+    : m_map (nullptr), m_maplen (0), m_data (nullptr)
+{
+#if ! defined (_WIN32)
+
+    int fd = open (file.c_str (), O_RDONLY);
+
+    if (fd < 0)
+        error ("cannot open data file '%s'", file.c_str ());
+
+    struct stat sb;
+
+    if (fstat (fd, &sb) != 0)
+    {
+        close (fd);
+        error ("cannot stat data file '%s'", file.c_str ());
+    }
+
+    if (offset + len > static_cast<double> (sb.st_size))
+    {
+        close (fd);
+        error ("data file '%s' is too short", file.c_str ());
+    }
+
+    if (len == 0)
+    {
+        close (fd);
+        return;
+    }
+
+    off_t off = static_cast<off_t> (offset);
+    off_t pagesize = sysconf (_SC_PAGESIZE);
+    off_t base = (off / pagesize) * pagesize;
+    m_maplen = (off - base) + static_cast<size_t> (len);
+
+    // private read-only mapping, pages are loaded on demand
+    void* map = mmap (0, m_maplen, PROT_READ, MAP_PRIVATE, fd, base);
+    close (fd);
+
+    if (map == MAP_FAILED)
+        error ("cannot map data file '%s'", file.c_str ());
+
+    if (sequential)
+        madvise (map, m_maplen, MADV_SEQUENTIAL);
+
+    m_map = map;
+    m_data = static_cast<const char*> (map) + (off - base);
+
+#else
+
+    FILE* fid = std::fopen (file.c_str (), "rb");
+
+    if (! fid)
+        error ("cannot open data file '%s'", file.c_str ());
+
+    m_buf.resize (static_cast<size_t> (len));
+
+    if (_fseeki64 (fid, static_cast<__int64> (offset), SEEK_SET) != 0
+        || std::fread (m_buf.data (), 1, m_buf.size (), fid) != m_buf.size ())
+    {
+        std::fclose (fid);
+        error ("data file '%s' is too short", file.c_str ());
+    }
+
+    std::fclose (fid);
+    m_data = m_buf.data ();
+
+#endif
+}
+
+control_mapped_file::~control_mapped_file ()
+{
+#if ! defined (_WIN32)
+    if (m_map)
+        munmap (m_map, m_maplen);
+#endif
+}
+
+static F77_INT control_ib01ad_count = 0;
+static F77_INT control_ib01ad_active = 0;
+
+F77_INT
+control_ib01ad_begin ()
+{
+    control_ib01ad_active = ++control_ib01ad_count;
+
+    return control_ib01ad_active;
+}
+
+bool
+control_ib01ad_owner (F77_INT id)
+{
+    return id != 0 && id == control_ib01ad_active;
+}
+
+void
+control_ib01ad_end (F77_INT id)
+{
+    if (control_ib01ad_owner (id))
+        control_ib01ad_active = 0;
+}
+
+// default cap of the memory kept by an empty arena, 64 MiB
+static std::atomic<double> control_arena_max (64.0 * 1024 * 1024);
+
+struct control_arena
+{
+    struct mark
+    {
+        size_t cur;
+        size_t top;
+    };
+
+    std::vector<char*> chunk;
+    std::vector<size_t> size;
+    std::vector<mark> marks;
+    size_t cur = 0;                     // current chunk
+    size_t top = 0;                     // bytes used in the current chunk
+    size_t held = 0;                    // bytes of all chunks
+    size_t high = 0;                    // bytes in use, high-water mark
+    size_t peak = 0;                    // largest held
+
+    ~control_arena () { free_from (0); }
+
+    void free_from (size_t k)
+    {
+        for (size_t i = k; i < chunk.size (); i++)
+        {
+            ::operator delete (chunk[i]);
+            held -= size[i];
+        }
+
+        chunk.resize (std::min (k, chunk.size ()));
+        size.resize (chunk.size ());
+    }
+
+    void add (size_t bytes)
+    {
+        chunk.push_back (static_cast<char*> (::operator new (bytes)));
+        size.push_back (bytes);
+        held += bytes;
+        peak = std::max (peak, held);
+    }
+
+    size_t in_use () const
+    {
+        size_t n = top;
+
+        for (size_t i = 0; i < cur && i < size.size (); i++)
+            n += size[i];
+
+        return n;
+    }
+
+    // empty arena:  one chunk of the high-water size, at most the cap
+    void trim ()
+    {
+        double lim = static_cast<double> (std::numeric_limits<size_t>::max () / 2);
+        size_t cap = static_cast<size_t> (std::max (0.0, std::min (control_arena_max.load (), lim)));
+        size_t keep = std::min (high, cap);
+
+        if (chunk.size () > 1 || held > cap)
+        {
+            free_from (0);
+
+            if (keep > 0)
+                add (keep);
+        }
+
+        cur = top = high = 0;
+    }
+};
+
+static thread_local control_arena arena;
+
+void* control_arena_push (size_t bytes)
+{
+    bytes = (bytes + 63) / 64 * 64;     // separate cache lines
+
+    arena.marks.push_back ({arena.cur, arena.top});
+
+    if (arena.chunk.empty () || arena.top + bytes > arena.size[arena.cur])
+    {
+        // the next chunk if it is large enough, otherwise a new one of
+        // at least twice the size of the arena
+        size_t next = arena.chunk.empty () ? 0 : arena.cur + 1;
+
+        if (next >= arena.chunk.size () || arena.size[next] < bytes)
+        {
+            arena.free_from (next);
+            arena.add (std::max (bytes, std::max (2 * arena.held, static_cast<size_t> (65536))));
+        }
+
+        arena.cur = next;
+        arena.top = 0;
+    }
+
+    void* ptr = arena.chunk[arena.cur] + arena.top;
+    arena.top += bytes;
+    arena.high = std::max (arena.high, arena.in_use ());
+
+    return ptr;
+}
+
+void control_arena_pop ()
+{
+    arena.cur = arena.marks.back ().cur;
+    arena.top = arena.marks.back ().top;
+    arena.marks.pop_back ();
+
+    if (arena.marks.empty ())
+        arena.trim ();
+}
+
+double control_arena_cap (double bytes)
+{
+    if (bytes < 0)
+        return control_arena_max.load ();
+
+    return control_arena_max.exchange (bytes);
+}
+
+void control_arena_release ()
+{
+    // buffers in use, e.g. by a caller further up in the call stack
+    if (! arena.marks.empty ())
+        return;
+
+    arena.free_from (0);
+    arena.cur = arena.top = arena.high = 0;
+}
+
+void control_arena_stats (double& held, double& peak)
+{
+    held = static_cast<double> (arena.held);
+    peak = static_cast<double> (arena.peak);
+}
+
+std::atomic<bool> control_profile_flag (false);
+static std::mutex control_profile_mutex;
+static std::map<std::string, control_profile_entry> control_profile_data;
+
+void control_profile::record (F77_INT info, F77_INT iwarn)
+{
+    double t = std::chrono::duration<double> (std::chrono::steady_clock::now ()
+                                              - m_start).count ();
+
+    std::lock_guard<std::mutex> lock (control_profile_mutex);
+    control_profile_entry& e = control_profile_data[m_routine];
+
+    e.calls++;
+    e.time += t;
+    e.maxtime = std::max (e.maxtime, t);
+    e.n = std::max (e.n, static_cast<double> (m_n));
+    e.m = std::max (e.m, static_cast<double> (m_m));
+    e.p = std::max (e.p, static_cast<double> (m_p));
+    e.workspace = std::max (e.workspace, 8 * m_ldwork);
+
+    if (info != 0)
+    {
+        e.errors++;
+        e.info = info;
+    }
+
+    if (iwarn != 0)
+        e.warnings++;
+}
+
+bool control_profile_enable (int on)
+{
+    if (on < 0)
+        return control_profile_flag.load ();
+
+    return control_profile_flag.exchange (on != 0);
+}
+
+void control_profile_reset ()
+{
+    std::lock_guard<std::mutex> lock (control_profile_mutex);
+    control_profile_data.clear ();
+}
+
+std::vector<std::pair<std::string, control_profile_entry>> control_profile_table ()
+{
+    std::lock_guard<std::mutex> lock (control_profile_mutex);
+
+    return std::vector<std::pair<std::string, control_profile_entry>>
+           (control_profile_data.begin (), control_profile_data.end ());
+}
+
+struct control_batch_entry
+{
+    int nargin_min;
+    int nargin_max;
+    control_batch_factory make;
+};
+
+// registry of this oct-file, filled while the oct-file is loaded
+static std::map<std::string, control_batch_entry>&
+control_batch_registry ()
+{
+    static std::map<std::string, control_batch_entry> registry;
+    return registry;
+}
+
+bool control_batch_register (const char* name, int nargin_min, int nargin_max,
+                             control_batch_factory make)
+{
+    control_batch_registry ()[name] = {nargin_min, nargin_max, make};
+    return true;
+}
+
+octave_value_list control_batch (const std::string& name, const Cell& items, int nthreads)
+{
+    const auto& registry = control_batch_registry ();
+    auto it = registry.find (name);
+
+    if (it == registry.end ())
+        error ("%s: no batch evaluation available", name.c_str ());
+
+    const control_batch_entry& entry = it->second;
+    octave_idx_type len = items.numel ();
+
+    // check all argument sets and allocate the results before the first call
+    std::vector<std::unique_ptr<control_batch_item>> item (len);
+
+    for (octave_idx_type k = 0; k < len; k++)
+    {
+        std::ostringstream os;
+        os << name << " (item " << k+1 << ")";
+
+        if (! items(k).iscell ())
+            error ("%s: argument set must be a cell array", os.str ().c_str ());
+
+        const octave_value_list args (items(k).cell_value ());
+
+        if (args.length () < entry.nargin_min || args.length () > entry.nargin_max)
+            error ("%s: %d arguments instead of %d to %d", os.str ().c_str (),
+                   static_cast<int> (args.length ()), entry.nargin_min, entry.nargin_max);
+
+        item[k] = entry.make (args, os.str ());
+    }
+
+    parallel_for (len, nthreads, [&] (octave_idx_type k)
+    {
+        item[k]->run (true);
+    });
+
+    Cell out (items.dims ());
+    NDArray info (items.dims ());
+    NDArray iwarn (items.dims ());
+
+    for (octave_idx_type k = 0; k < len; k++)
+    {
+        info(k) = item[k]->info;
+        iwarn(k) = item[k]->iwarn;
+
+        if (item[k]->info == 0)
+            out(k) = Cell (item[k]->result ());
+        else
+            out(k) = Cell ();
+
+        item[k].reset ();
+    }
+
+    octave_value_list retval;
+    retval(0) = out;
+    retval(1) = info;
+    retval(2) = iwarn;
+
+    return retval;
+}
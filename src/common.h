@@ -21,14 +21,22 @@ Common code for oct-files.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: February 2012
-Version: 0.2
+Version: 0.11
 
 */
 
 #ifndef COMMON_H
 #define COMMON_H
 
+#include <octave/oct.h>
+#include <octave/Cell.h>
 #include <octave/f77-fcn.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 
 #if defined (OCTAVE_HAVE_F77_INT_TYPE)
 #  define TO_F77_INT(x) octave::to_f77_int (x)
@@ -48,6 +56,270 @@ void error_msg (const char name[], octave_idx_type index, octave_idx_type max, c
 void warning_msg (const char name[], octave_idx_type index, octave_idx_type max, const char* msg[]);
 void warning_msg (const char name[], octave_idx_type index, octave_idx_type max, const char* msg[], octave_idx_type offset);
 
+// Marshalling of matrix arguments for SLICOT routines.
+// control_input returns the data of a read-only operand.  The data is shared
+// with the caller and never copied; the cast only serves the Fortran
+// prototypes without const.  Operands which are overwritten by the routine
+// are copied from args as usual.
+inline double* control_input (const Matrix& m)
+{
+    return const_cast<double*> (m.data ());
+}
+
+// Workspace length between the minimal length lmin and the optimal
+// length lopt (number of doubles), limited by a memory budget in bytes.
+// budget <= 0:  no limit.  Safe to call from parallel_for.
+F77_INT control_workspace (double lmin, double lopt, double budget);
+
+// Workspace length of a routine between the minimal length lmin and the
+// optimal length within the budget of control_ldwork_budget (bytes,
+// 256 MiB by default, <= 0 for no limit).  The optimum comes from query,
+// a call with LDWORK = -1 returning DWORK(1), for routines which support
+// workspace queries, otherwise it is lmin plus ncol columns of the LAPACK
+// block size for the blocked kernels called by the routine.  Optima are
+// cached per routine and dimensions.
+F77_INT control_ldwork (const std::string& routine, const std::vector<F77_INT>& dims,
+                        double lmin, double ncol,
+                        const std::function<double ()>& query = nullptr);
+double control_ldwork_budget (double bytes = -1);   // set the budget (bytes >= 0), return the old one
+F77_INT control_block_size ();
+
+// Run fcn (i) for i = 0, ..., n-1 on at most nthreads threads.
+// fcn must not call into the interpreter (error, warning, octave_quit).
+// While more than one thread runs, the BLAS library uses one thread.
+int control_threads (int nthreads);
+void parallel_for (octave_idx_type n, int nthreads,
+                   const std::function<void (octave_idx_type)>& fcn);
+
+// Number of threads of the BLAS library.  The backend, FlexiBLAS,
+// OpenBLAS, MKL or BLIS, is detected at run time from the symbols of the
+// process, "unknown" if none of them is found.  control_blas_threads sets
+// the number of threads (nthreads >= 1) and returns the old one, 0 for an
+// unknown backend.
+std::string control_blas_backend ();
+int control_blas_threads (int nthreads = -1);
+
+// Per-thread arena for the work arrays of the SLICOT routines.  Buffers
+// are taken from the arena and returned in LIFO order by scope, such that
+// repeated calls reuse the same memory.  The arena grows geometrically;
+// once it is empty again, it is consolidated into one block of the
+// high-water size, at most control_arena_cap bytes.
+void* control_arena_push (size_t bytes);
+void control_arena_pop ();
+double control_arena_cap (double bytes = -1);   // set the cap (bytes >= 0), return the old one
+void control_arena_release ();                  // free the arena of this thread
+void control_arena_stats (double& held, double& peak);
+
+template <typename T>
+class control_arena_buffer
+{
+public:
+    explicit control_arena_buffer (octave_idx_type n)
+        : m_data (static_cast<T*> (control_arena_push (sizeof (T) * (n > 0 ? n : 1))))
+    { }
+
+    ~control_arena_buffer () { control_arena_pop (); }
+
+    T* data () const { return m_data; }
+
+private:
+    control_arena_buffer (const control_arena_buffer&) = delete;
+    control_arena_buffer& operator = (const control_arena_buffer&) = delete;
+
+    T* m_data;
+};
+
+// drop-in replacement of OCTAVE_LOCAL_BUFFER for trivial types
+#define CONTROL_WORK_BUFFER(T, buf, size) \
+    control_arena_buffer<T> buf ## _arena (size); \
+    T* buf = buf ## _arena.data ()
+
+// Profiling of the SLICOT, LAPACK and BLAS calls, see __control_profile__.
+// CONTROL_XFCN records the wall time, the dimensions n, m, p of the problem,
+// the length of the real workspace and INFO and IWARN of a call.  Calls,
+// time, largest dimensions and workspace, and nonzero INFO and IWARN are
+// accumulated per routine.  While profiling is off (default), a call costs
+// one atomic load.  A call which is left by an exception counts as error.
+// Safe to use in parallel_for.
+struct control_profile_entry
+{
+    double calls = 0;
+    double time = 0;            // seconds
+    double maxtime = 0;
+    double n = 0, m = 0, p = 0; // largest dimensions
+    double workspace = 0;       // largest real workspace in bytes
+    double errors = 0;          // calls with INFO != 0
+    double warnings = 0;        // calls with IWARN != 0
+    double info = 0;            // last nonzero INFO
+};
+
+extern std::atomic<bool> control_profile_flag;
+
+class control_profile
+{
+public:
+    control_profile (const char* routine, F77_INT n, F77_INT m, F77_INT p, double ldwork)
+        : m_on (control_profile_flag.load (std::memory_order_relaxed))
+    {
+        if (m_on)
+        {
+            m_routine = routine;
+            m_n = n;
+            m_m = m;
+            m_p = p;
+            m_ldwork = ldwork;
+            m_start = std::chrono::steady_clock::now ();
+        }
+    }
+
+    ~control_profile () { if (m_on) record (-1, 0); }
+
+    void stop (F77_INT info, F77_INT iwarn = 0)
+    {
+        if (m_on)
+            record (info, iwarn);
+
+        m_on = false;
+    }
+
+private:
+    control_profile (const control_profile&) = delete;
+    control_profile& operator = (const control_profile&) = delete;
+
+    void record (F77_INT info, F77_INT iwarn);
+
+    bool m_on;
+    const char* m_routine;
+    F77_INT m_n, m_m, m_p;
+    double m_ldwork;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// F77_XFCN with profiling.  dims = (n, m, p, ldwork) and result = (info)
+// or (info, iwarn) of the call, e.g.
+//     CONTROL_XFCN (sb03od, SB03OD, (n, m, 0, ldwork), (info),
+//                  (dico, fact, trans, n, m, ...));
+#define CONTROL_PROFILE_ARGS(...) __VA_ARGS__
+#define CONTROL_XFCN(f, F, dims, result, args) \
+    do \
+    { \
+        control_profile control_profile_call (#F, CONTROL_PROFILE_ARGS dims); \
+        F77_XFCN (f, F, args); \
+        control_profile_call.stop result; \
+    } while (0)
+
+bool control_profile_enable (int on);   // on: 1 enable, 0 disable, < 0 query; return the old state
+void control_profile_reset ();
+std::vector<std::pair<std::string, control_profile_entry>> control_profile_table ();
+
+// CONTROL_XFCN for code which runs in parallel_for.  The routine is called
+// directly, without the interrupt handling of F77_XFCN.
+#define CONTROL_FCN(f, F, dims, result, args) \
+    do \
+    { \
+        control_profile control_profile_call (#F, CONTROL_PROFILE_ARGS dims); \
+        F77_FUNC (f, F) args; \
+        control_profile_call.stop result; \
+    } while (0)
+
+// CONTROL_FCN for routines which are functions, e.g. AB13BD.  F77_XFCN
+// discards the value, therefore they are called directly in all threads.
+//     CONTROL_FCN_VALUE (norm, ab13bd, AB13BD, (n, m, p, ldwork), (info, iwarn),
+//                        (dico, jobn, n, m, p, ...));
+#define CONTROL_FCN_VALUE(value, f, F, dims, result, args) \
+    do \
+    { \
+        control_profile control_profile_call (#F, CONTROL_PROFILE_ARGS dims); \
+        value = F77_FUNC (f, F) args; \
+        control_profile_call.stop result; \
+    } while (0)
+
+// CONTROL_FCN in a worker thread, CONTROL_XFCN in the interpreter thread,
+// for code which runs in both, see control_batch_item.
+#define CONTROL_CALL(worker, f, F, dims, result, args) \
+    do \
+    { \
+        if (worker) \
+            CONTROL_FCN (f, F, dims, result, args); \
+        else \
+            CONTROL_XFCN (f, F, dims, result, args); \
+    } while (0)
+
+// Batch evaluation of a wrapper for many argument sets, see control_batch.
+// A problem is constructed from the arguments of one call in the
+// interpreter thread, where it checks the arguments, makes the operands
+// which the routine overwrites unique and allocates all results.
+// run (true) calls the SLICOT routine in a worker thread.  It must not
+// touch an octave_value or call into the interpreter, and takes its work
+// arrays from the arena of the worker.  The wrapper itself calls
+// run (false) in the interpreter thread, where the routine is called by
+// F77_XFCN, see CONTROL_CALL.  result () returns the outputs in the
+// interpreter thread.  who is the name used in error messages.
+struct control_batch_item
+{
+    virtual ~control_batch_item () { }
+    virtual void run (bool worker) = 0;
+    virtual octave_value_list result () const = 0;
+
+    F77_INT info = 0;
+    F77_INT iwarn = 0;
+};
+
+typedef std::unique_ptr<control_batch_item>
+    (*control_batch_factory) (const octave_value_list& args, const std::string& who);
+
+template <typename T>
+std::unique_ptr<control_batch_item>
+control_batch_make (const octave_value_list& args, const std::string& who)
+{
+    return std::unique_ptr<control_batch_item> (new T (args, who));
+}
+
+// Register problem type T of wrapper name with nargin arguments, e.g.
+//     static const bool sb03md_batch
+//         = control_batch_register ("__sl_sb03md__", 3, 5, control_batch_make<sb03md_problem>);
+bool control_batch_register (const char* name, int nargin_min, int nargin_max,
+                             control_batch_factory make);
+
+// Run wrapper name for every argument set of items, a cell array of cell
+// arrays, on at most nthreads threads.  All argument sets are checked
+// before the first call.  Returns a cell array of the outputs of every
+// call, empty for calls with nonzero INFO, and the arrays of INFO and
+// IWARN, all of the size of items.
+octave_value_list control_batch (const std::string& name, const Cell& items, int nthreads);
+
+// Read-only view of the bytes [offset, offset+len) of a file.  The file
+// is memory-mapped where available and read into memory otherwise.
+// sequential advises the kernel that the data are read once in order.
+class control_mapped_file
+{
+public:
+    control_mapped_file (const std::string& file, double offset, double len,
+                         bool sequential = false);
+    ~control_mapped_file ();
+
+    const char* data () const { return m_data; }
+
+private:
+    control_mapped_file (const control_mapped_file&) = delete;
+    control_mapped_file& operator = (const control_mapped_file&) = delete;
+
+    void* m_map;
+    size_t m_maplen;
+    std::vector<char> m_buf;
+    const char* m_data;
+};
+
+// IB01AD keeps part of the state of sequential data (BATCH = 'F', 'I',
+// 'L') in SAVEd local variables, which the oct-file shares among all its
+// wrappers.  Every use of IB01AD starts with control_ib01ad_begin, which
+// invalidates the stream which used it before.  A data stream over several
+// calls keeps the returned id and checks control_ib01ad_owner (id) before
+// every further batch, and calls control_ib01ad_end (id) after the last.
+F77_INT control_ib01ad_begin ();
+bool control_ib01ad_owner (F77_INT id);
+void control_ib01ad_end (F77_INT id);
+
 // FIXME: Keep until Octave 4.2 and older are no longer supported.
 // This conditional defines f77_exception_encountered as a dummy constant
 // to preserve code that needed to check its value to work correctly in older
@@ -0,0 +1,217 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Workspace arena, workspace budget, profiling, batch evaluation and BLAS
+threads of an oct-file, see common.h.  Every oct-file of the SLICOT wrappers links its
+own copy of common.cc and forwards the calls of its stub function to
+control_state.  __control_arena__.m, __control_profile__.m,
+__control_batch__.m and __control_blas__.m combine the oct-files.
+
+    info = fcn ("arena")                  held and peak bytes, cap, budget
+    old = fcn ("arena", "cap", bytes)     memory kept between calls
+    fcn ("arena", "release")              free the arena
+    old = fcn ("arena", "budget", bytes)  budget of optimal workspaces
+
+    tab = fcn ("profile")                 struct array, one element per routine
+    old = fcn ("profile", "on")           enable profiling
+    old = fcn ("profile", "off")          disable profiling
+    fcn ("profile", "reset")              clear the table
+
+    [out, info, iwarn] = fcn ("batch", name, items, nthreads)
+                                          calls of wrapper name, see control_batch
+
+    info = fcn ("blas")                   BLAS backend and number of threads
+    old = fcn ("blas", nthreads)          set the number of BLAS threads
+
+The fields of tab are routine, calls, time and maxtime in seconds, the
+largest dimensions n, m, p and workspace in bytes, the number of calls
+with nonzero INFO (errors) and IWARN (warnings), and the last nonzero INFO.
+
+Created: October 2026
+Version: 0.5
+
+*/
+
+#include <octave/oct.h>
+#include <octave/oct-map.h>
+#include "common.h"
+
+static octave_value
+control_arena_state (const octave_value_list& args)
+{
+    octave_idx_type nargin = args.length ();
+    octave_value retval;
+
+    if (nargin == 1)
+    {
+        double held, peak;
+        control_arena_stats (held, peak);
+
+        octave_scalar_map info;
+        info.assign ("held", held);
+        info.assign ("peak", peak);
+        info.assign ("cap", control_arena_cap ());
+        info.assign ("budget", control_ldwork_budget ());
+
+        retval = info;
+    }
+    else
+    {
+        std::string opt = args(1).string_value ();
+
+        if (opt == "release" && nargin == 2)
+            control_arena_release ();
+        else if (opt == "cap" && nargin == 3)
+            retval = control_arena_cap (args(2).double_value ());
+        else if (opt == "budget" && nargin == 3)
+            retval = control_ldwork_budget (args(2).double_value ());
+        else
+            print_usage ();
+    }
+
+    return retval;
+}
+
+static octave_value
+control_profile_state (const octave_value_list& args)
+{
+    octave_idx_type nargin = args.length ();
+    octave_value retval;
+
+    if (nargin == 1)
+    {
+        const auto table = control_profile_table ();
+        octave_idx_type len = table.size ();
+
+        Cell routine (len, 1), calls (len, 1), time (len, 1), maxtime (len, 1);
+        Cell n (len, 1), m (len, 1), p (len, 1), workspace (len, 1);
+        Cell errors (len, 1), warnings (len, 1), info (len, 1);
+
+        for (octave_idx_type k = 0; k < len; k++)
+        {
+            const control_profile_entry& e = table[k].second;
+
+            routine(k) = table[k].first;
+            calls(k) = e.calls;
+            time(k) = e.time;
+            maxtime(k) = e.maxtime;
+            n(k) = e.n;
+            m(k) = e.m;
+            p(k) = e.p;
+            workspace(k) = e.workspace;
+            errors(k) = e.errors;
+            warnings(k) = e.warnings;
+            info(k) = e.info;
+        }
+
+        octave_map tab (dim_vector (len, 1));
+        tab.assign ("routine", routine);
+        tab.assign ("calls", calls);
+        tab.assign ("time", time);
+        tab.assign ("maxtime", maxtime);
+        tab.assign ("n", n);
+        tab.assign ("m", m);
+        tab.assign ("p", p);
+        tab.assign ("workspace", workspace);
+        tab.assign ("errors", errors);
+        tab.assign ("warnings", warnings);
+        tab.assign ("info", info);
+
+        retval = tab;
+    }
+    else
+    {
+        std::string opt = args(1).string_value ();
+
+        if (opt == "on" && nargin == 2)
+            retval = control_profile_enable (1);
+        else if (opt == "off" && nargin == 2)
+            retval = control_profile_enable (0);
+        else if (opt == "reset" && nargin == 2)
+            control_profile_reset ();
+        else
+            print_usage ();
+    }
+
+    return retval;
+}
+
+static octave_value_list
+control_batch_state (const octave_value_list& args)
+{
+    if (args.length () != 4)
+        print_usage ();
+
+    std::string name = args(1).string_value ();
+    const Cell items = args(2).cell_value ();
+    int nthreads = args(3).int_value ();
+
+    return control_batch (name, items, nthreads);
+}
+
+static octave_value
+control_blas_state (const octave_value_list& args)
+{
+    octave_idx_type nargin = args.length ();
+    octave_value retval;
+
+    if (nargin == 1)
+    {
+        octave_scalar_map info;
+        info.assign ("backend", control_blas_backend ());
+        info.assign ("threads", control_blas_threads ());
+
+        retval = info;
+    }
+    else if (nargin == 2)
+    {
+        int nthreads = args(1).int_value ();
+
+        if (nthreads < 1)
+            error ("number of BLAS threads must be positive");
+
+        retval = control_blas_threads (nthreads);
+    }
+    else
+        print_usage ();
+
+    return retval;
+}
+
+static octave_value_list
+control_state (const char* name, const octave_value_list& args)
+{
+    octave_value_list retval;
+
+    std::string what = (args.length () > 0 && args(0).is_string ())
+                       ? args(0).string_value () : "";
+
+    if (what == "arena")
+        retval(0) = control_arena_state (args);
+    else if (what == "profile")
+        retval(0) = control_profile_state (args);
+    else if (what == "batch")
+        retval = control_batch_state (args);
+    else if (what == "blas")
+        retval(0) = control_blas_state (args);
+    else
+        error ("%s: for internal use only", name);
+
+    return retval;
+}
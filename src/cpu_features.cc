@@ -0,0 +1,63 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Instruction set extensions of the CPU for the selection of the variants
+of the SLICOT oct-files, see __control_isa__.m.
+
+Created: October 2026
+Version: 0.1
+
+*/
+
+#include <octave/oct.h>
+#include <octave/oct-map.h>
+#include "config.h"
+
+// PKG_ADD: autoload ("__control_cpu__", "__control_helper_functions__.oct");
+DEFUN_DLD (__control_cpu__, args, ,
+   "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {@var{cpu} =} __control_cpu__ ()\n\
+Return a struct with the logical fields @var{avx2} (AVX2 and FMA) and\n\
+@var{avx512} (AVX-512 F, DQ and VL) which are true if the CPU and the\n\
+operating system support these instruction set extensions.\n\
+For internal use only.\n\
+@end deftypefn")
+{
+    if (args.length () != 0)
+        print_usage ();
+
+    bool avx2 = false;
+    bool avx512 = false;
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+    // CPUID, including the check of XGETBV for the register state
+    __builtin_cpu_init ();
+
+    avx2 = __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma");
+    avx512 = avx2 && __builtin_cpu_supports ("avx512f")
+             && __builtin_cpu_supports ("avx512dq")
+             && __builtin_cpu_supports ("avx512vl");
+#endif
+
+    octave_scalar_map cpu;
+    cpu.assign ("avx2", avx2);
+    cpu.assign ("avx512", avx512);
+
+    return octave_value (cpu);
+}
@@ -0,0 +1,297 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Argument checks of the ss and tf constructors in one call, replacing
+__adjust_ss_data__, __ss_dim__, __adjust_tf_data__, __tf_dim__ and the
+checks of the sampling time for the matrices and vectors passed by users.
+The error messages are the same.
+
+Created: October 2026
+Version: 0.1
+
+*/
+
+#include <octave/oct.h>
+#include <octave/Cell.h>
+#include "config.h"
+#include <algorithm>
+
+static bool
+lti_is_real_matrix (const octave_value& x)
+{
+    return x.ndims () == 2 && x.OV_ISNUMERIC () && x.OV_ISREAL ();
+}
+
+static bool
+lti_is_real_vector (const octave_value& x)
+{
+    return lti_is_real_matrix (x) && (x.rows () == 1 || x.columns () == 1);
+}
+
+// tsam = [] means unspecified (-1), otherwise issample (tsam, -10)
+static double
+lti_sampling_time (const octave_value& tsam, const char* name)
+{
+    if (tsam.isempty () && lti_is_real_matrix (tsam))
+        return -1;
+
+    if (! (tsam.is_scalar_type () && lti_is_real_matrix (tsam)))
+        error ("%s: invalid sampling time", name);
+
+    double t = tsam.double_value ();
+
+    if (! (t >= 0 || t == -1))
+        error ("%s: invalid sampling time", name);
+
+    return t;
+}
+
+// PKG_ADD: autoload ("__ss_validate__", "__control_helper_functions__.oct");
+DEFUN_DLD (__ss_validate__, args, ,
+   "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {[@var{a}, @var{b}, @var{c}, @var{d}, @var{tsam}, @var{p}, @var{m}, @var{n}] =} __ss_validate__ (@var{a}, @var{b}, @var{c}, @var{d}, @var{tsam})\n\
+Complete and check the arguments of the ss constructor.  For internal use only.\n\
+@end deftypefn")
+{
+    octave_value_list retval;
+
+    if (args.length () != 5)
+    {
+        print_usage ();
+    }
+    else
+    {
+        octave_value a = args(0);
+        octave_value b = args(1);
+        octave_value c = args(2);
+        octave_value d = args(3);
+        double tsam = lti_sampling_time (args(4), "ss");
+
+        // __adjust_ss_data__
+        if (d.isempty ())
+        {
+            if (c.rows () == 0 && c.columns () == 0)
+            {
+                // ss (a, b), ss (a, b, [], [], ...), but allow c(0xn) and d(0xm)
+                Matrix eye (a.rows (), a.columns (), 0.0);
+
+                for (octave_idx_type i = 0; i < std::min (a.rows (), a.columns ()); i++)
+                    eye(i,i) = 1.0;
+
+                c = eye;
+                d = Matrix (a.rows (), b.columns (), 0.0);
+            }
+            else
+                d = Matrix (c.rows (), b.columns (), 0.0);   // ss (a, b, c), ss (a, b, c, [], ...)
+        }
+
+        if (b.isempty () && c.isempty ())
+        {
+            // sys = ss ([], [], [], d)
+            b = Matrix (0, d.columns ());
+            c = Matrix (d.rows (), 0);
+        }
+
+        if (d.is_scalar_type () && lti_is_real_matrix (d) && d.double_value () == 0)
+            d = Matrix (c.rows (), b.columns (), 0.0);  // ss (a, b, c, 0), but not ss (0)
+
+        // __ss_dim__
+        int arows = a.rows (), acols = a.columns ();
+        int brows = b.rows (), bcols = b.columns ();
+        int crows = c.rows (), ccols = c.columns ();
+        int drows = d.rows (), dcols = d.columns ();
+
+        if (arows != acols)
+            error ("ss: system matrix a(%dx%d) is not square", arows, acols);
+
+        if (brows != arows)
+            error ("ss: system matrices a(%dx%d) and b(%dx%d) are incompatible",
+                   arows, acols, brows, bcols);
+
+        if (ccols != acols)
+            error ("ss: system matrices a(%dx%d) and c(%dx%d) are incompatible",
+                   arows, acols, crows, ccols);
+
+        if (bcols != dcols)
+            error ("ss: system matrices b(%dx%d) and d(%dx%d) are incompatible",
+                   brows, bcols, drows, dcols);
+
+        if (crows != drows)
+            error ("ss: system matrices c(%dx%d) and d(%dx%d) are incompatible",
+                   crows, ccols, drows, dcols);
+
+        retval(7) = arows;
+        retval(6) = bcols;
+        retval(5) = crows;
+        retval(4) = tsam;
+        retval(3) = d;
+        retval(2) = c;
+        retval(1) = b;
+        retval(0) = a;
+    }
+
+    return retval;
+}
+
+// true if p is of the form b0 or 0 without leading zeros
+static bool
+tf_is_constant (const octave_value& p)
+{
+    const NDArray v = p.array_value ();
+    octave_idx_type len = v.numel ();
+
+    for (octave_idx_type k = 0; k < len; k++)
+        if (v(k) != 0)
+            return k == len - 1;
+
+    return true;
+}
+
+static bool
+tf_is_zero (const octave_value& p)
+{
+    const NDArray v = p.array_value ();
+
+    for (octave_idx_type k = 0; k < v.numel (); k++)
+        if (v(k) != 0)
+            return false;
+
+    return true;
+}
+
+// PKG_ADD: autoload ("__tf_validate__", "__control_helper_functions__.oct");
+DEFUN_DLD (__tf_validate__, args, ,
+   "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {[@var{num}, @var{den}, @var{tsam}, @var{tfvar}, @var{p}, @var{m}] =} __tf_validate__ (@var{num}, @var{den}, @var{tsam})\n\
+Complete and check the arguments of the tf constructor.  @var{num} and\n\
+@var{den} are returned as cells of real-valued vectors.  For cells which\n\
+contain objects, @var{tfvar} is empty and the arguments are not checked.\n\
+For internal use only.\n\
+@end deftypefn")
+{
+    octave_value_list retval;
+
+    if (args.length () != 3)
+    {
+        print_usage ();
+    }
+    else
+    {
+        octave_value num = args(0);
+        octave_value den = args(1);
+        double tsam = lti_sampling_time (args(2), "tf");
+        bool static_gain = false;
+
+        // __adjust_tf_data__
+        if (den.isempty ())
+        {
+            if (num.isempty ())
+            {
+                // tf ([], [])
+                num = den = Cell ();
+                static_gain = true;
+            }
+            else if (lti_is_real_matrix (num))
+            {
+                // static gain  tf (matrix),  tf (matrix, [])
+                const Matrix k = num.matrix_value ();
+                Cell cnum (k.dims ());
+                Cell cden (k.dims ());
+
+                for (octave_idx_type i = 0; i < k.numel (); i++)
+                {
+                    cnum(i) = k(i);
+                    cden(i) = 1.0;
+                }
+
+                num = cnum;
+                den = cden;
+                static_gain = true;
+            }
+        }
+
+        const Cell cnum = num.OV_ISCELL () ? num.cell_value () : Cell (num);
+        const Cell cden = den.OV_ISCELL () ? den.cell_value () : Cell (den);
+
+        // cells with objects: the arguments unchanged, empty tfvar, p and m
+        retval(5) = Matrix ();
+        retval(4) = Matrix ();
+        retval(3) = Matrix ();
+        retval(2) = tsam;
+        retval(1) = args(1);
+        retval(0) = args(0);
+
+        for (octave_idx_type i = 0; i < cnum.numel (); i++)
+            if (cnum(i).OV_ISOBJECT ())
+                return retval;
+
+        for (octave_idx_type i = 0; i < cden.numel (); i++)
+            if (cden(i).OV_ISOBJECT ())
+                return retval;
+
+        retval(0) = cnum;
+        retval(1) = cden;
+
+        // all transfer functions of the form b0/a0
+        bool all_constant = true;
+
+        for (octave_idx_type i = 0; i < cnum.numel () && all_constant; i++)
+            if (! lti_is_real_matrix (cnum(i)) || ! tf_is_constant (cnum(i)))
+                all_constant = false;
+
+        for (octave_idx_type i = 0; i < cden.numel () && all_constant; i++)
+            if (! lti_is_real_matrix (cden(i)) || ! tf_is_constant (cden(i)))
+                all_constant = false;
+
+        if (all_constant)
+            static_gain = true;
+
+        for (octave_idx_type i = 0; i < cnum.numel (); i++)
+            if (! lti_is_real_vector (cnum(i)))
+                error ("tf: numerator 'num' must be a real-valued, non-empty vector or a cell of such vectors");
+
+        for (octave_idx_type i = 0; i < cden.numel (); i++)
+            if (! lti_is_real_vector (cden(i)))
+                error ("tf: denominator 'den' must be a real-valued, non-empty vector or a cell of such vectors");
+
+        for (octave_idx_type i = 0; i < cden.numel (); i++)
+            if (tf_is_zero (cden(i)))
+                error ("tf: denominator(s) cannot be zero");
+
+        // __tf_dim__
+        int nrows = cnum.rows (), ncols = cnum.columns ();
+        int drows = cden.rows (), dcols = cden.columns ();
+
+        if (nrows != drows || ncols != dcols)
+            error ("tf: arguments 'num' (%dx%d) and 'den' (%dx%d) must have equal dimensions",
+                   nrows, ncols, drows, dcols);
+
+        if (static_gain)
+            retval(3) = "x";
+        else if (tsam == 0)
+            retval(3) = "s";
+        else
+            retval(3) = "z";
+
+        retval(5) = ncols;
+        retval(4) = nrows;
+    }
+
+    return retval;
+}
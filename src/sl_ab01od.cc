@@ -23,7 +23,7 @@ Uses SLICOT AB01OD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: August 2010
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -48,7 +48,7 @@ extern "C"
                   F77_INT& INFO);
 }
  
-// PKG_ADD: autoload ("__sl_ab01od__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_ab01od__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_ab01od__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB01OD Release 5.0\n\
@@ -88,33 +88,33 @@ For internal use only.")
         F77_INT ncont;
         F77_INT indcon;
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, kstair, n);
+        CONTROL_WORK_BUFFER (F77_INT, kstair, n);
         
         // workspace
         F77_INT ldwork = max (1, n + max (n, 3*m));
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, m);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, m);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info;
 
 
         // SLICOT routine AB01OD
-        F77_XFCN (ab01od, AB01OD,
-                 (stages,
-                  jobu, jobv,
-                  n, m,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  u.fortran_vec (), ldu,
-                  v, ldv,
-                  ncont, indcon,
-                  kstair,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (ab01od, AB01OD, (n, m, 0, ldwork), (info),
+                     (stages,
+                      jobu, jobv,
+                      n, m,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      u.fortran_vec (), ldu,
+                      v, ldv,
+                      ncont, indcon,
+                      kstair,
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("__sl_ab01od__: exception in SLICOT subroutine AB01OD");
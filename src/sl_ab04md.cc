@@ -24,7 +24,7 @@ Uses SLICOT AB04MD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: September 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -46,7 +46,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ab04md__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_ab04md__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_ab04md__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB04MD Release 5.0\n\
@@ -91,25 +91,25 @@ For internal use only.")
         // workspace
         F77_INT ldwork = max (1, n);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, n);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, n);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine AB04MD
-        F77_XFCN (ab04md, AB04MD,
-                 (type,
-                  n, m, p,
-                  alpha, beta,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (ab04md, AB04MD, (n, m, p, ldwork), (info),
+                     (type,
+                      n, m, p,
+                      alpha, beta,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("__sl_ab04md__: exception in SLICOT subroutine AB04MD");
@@ -23,7 +23,7 @@ Uses SLICOT AB08ND by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: November 2009
-Version: 0.8
+Version: 0.9
 
 */
 
@@ -63,7 +63,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ab08nd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_ab08nd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_ab08nd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB08ND Release 5.0\n\
@@ -112,19 +112,19 @@ For internal use only.")
         F77_INT ldaf = max (1, n + m);
         F77_INT ldbf = max (1, n + p);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, infz, n);
-        OCTAVE_LOCAL_BUFFER (F77_INT, kronr, 1 + max (n, m));
-        OCTAVE_LOCAL_BUFFER (F77_INT, kronl, 1 + max (n, p));
+        CONTROL_WORK_BUFFER (F77_INT, infz, n);
+        CONTROL_WORK_BUFFER (F77_INT, kronr, 1 + max (n, m));
+        CONTROL_WORK_BUFFER (F77_INT, kronl, 1 + max (n, p));
         
-        OCTAVE_LOCAL_BUFFER (double, af, ldaf * (n + min (p, m)));
-        OCTAVE_LOCAL_BUFFER (double, bf, ldbf * (n + m));
+        CONTROL_WORK_BUFFER (double, af, ldaf * (n + min (p, m)));
+        CONTROL_WORK_BUFFER (double, bf, ldbf * (n + m));
 
         // workspace
         F77_INT s = max (m, p);
         F77_INT ldwork = max (1, max (s, n) + max (3*s-1, n+s));
         
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, s);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, s);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicator
         F77_INT info;
@@ -133,21 +133,21 @@ For internal use only.")
         double tol = 0;     // AB08ND uses DLAMCH for default tolerance
 
         // SLICOT routine AB08ND
-        F77_XFCN (ab08nd, AB08ND,
-                 (equil,
-                  n, m, p,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  nu, rank, dinfz,
-                  nkror, nkrol, infz,
-                  kronr, kronl,
-                  af, ldaf,
-                  bf, ldbf,
-                  tol,
-                  iwork, dwork, ldwork,
-                  info));
+        CONTROL_XFCN (ab08nd, AB08ND, (n, m, p, ldwork), (info),
+                     (equil,
+                      n, m, p,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      nu, rank, dinfz,
+                      nkror, nkrol, infz,
+                      kronr, kronl,
+                      af, ldaf,
+                      bf, ldbf,
+                      tol,
+                      iwork, dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("ss: zero: __sl_ab08nd__: exception in SLICOT subroutine AB08ND");
@@ -166,7 +166,7 @@ For internal use only.")
         F77_INT ldvr = 1;
         
         F77_INT lwork = max (1, 8*nu);
-        OCTAVE_LOCAL_BUFFER (double, work, lwork);
+        CONTROL_WORK_BUFFER (double, work, lwork);
         
         ColumnVector alphar (nu);
         ColumnVector alphai (nu);
@@ -174,17 +174,17 @@ For internal use only.")
         
         F77_INT info2;
         
-        F77_XFCN (dggev, DGGEV,
-                 (jobvl, jobvr,
-                  nu,
-                  af, ldaf,
-                  bf, ldbf,
-                  alphar.fortran_vec (), alphai.fortran_vec (),
-                  beta.fortran_vec (),
-                  vl, ldvl,
-                  vr, ldvr,
-                  work, lwork,
-                  info2));
+        CONTROL_XFCN (dggev, DGGEV, (nu, 0, 0, lwork), (info2),
+                     (jobvl, jobvr,
+                      nu,
+                      af, ldaf,
+                      bf, ldbf,
+                      alphar.fortran_vec (), alphai.fortran_vec (),
+                      beta.fortran_vec (),
+                      vl, ldvl,
+                      vr, ldvr,
+                      work, lwork,
+                      info2));
                                  
         if (f77_exception_encountered)
             error ("ss: zero: __sl_ab08nd__: exception in LAPACK subroutine DGGEV");
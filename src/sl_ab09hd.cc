@@ -23,7 +23,7 @@ Uses SLICOT AB09HD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: October 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -50,7 +50,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ab09hd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_ab09hd__", "__control_slicot_modred__.oct");    
 DEFUN_DLD (__sl_ab09hd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB09HD Release 5.0\n\
@@ -147,9 +147,9 @@ For internal use only.")
         F77_INT ldwork = 2*n*n + mb*(n+p)
                      + max (2, n*(max (n,mb,p)+5), 2*n*p + max (p*(mb+2), 10*n*(n+1)));
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
         
         // error indicators
         F77_INT iwarn = 0;
@@ -157,22 +157,22 @@ For internal use only.")
 
 
         // SLICOT routine AB09HD
-        F77_XFCN (ab09hd, AB09HD,
-                 (dico, job, equil, ordsel,
-                  n, m, p,
-                  nr,
-                  alpha, beta,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  ns,
-                  hsv.fortran_vec (),
-                  tol1, tol2,
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  iwarn, info));
+        CONTROL_XFCN (ab09hd, AB09HD, (n, m, p, ldwork), (info, iwarn),
+                     (dico, job, equil, ordsel,
+                      n, m, p,
+                      nr,
+                      alpha, beta,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      ns,
+                      hsv.fortran_vec (),
+                      tol1, tol2,
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      iwarn, info));
 
         if (f77_exception_encountered)
             error ("bstmodred: exception in SLICOT subroutine AB09HD");
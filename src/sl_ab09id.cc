@@ -24,7 +24,7 @@ Uses SLICOT AB09ID by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: October 2011
-Version: 0.2
+Version: 0.4
 
 */
 
@@ -60,7 +60,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ab09id__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_ab09id__", "__control_slicot_modred__.oct");    
 DEFUN_DLD (__sl_ab09id__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB09ID Release 5.0\n\
@@ -100,12 +100,12 @@ For internal use only.")
         Matrix av = args(10).matrix_value ();
         Matrix bv = args(11).matrix_value ();
         Matrix cv = args(12).matrix_value ();
-        Matrix dv = args(13).matrix_value ();
+        const Matrix dv = args(13).matrix_value ();
       
         Matrix aw = args(14).matrix_value ();
         Matrix bw = args(15).matrix_value ();
         Matrix cw = args(16).matrix_value ();
-        Matrix dw = args(17).matrix_value ();
+        const Matrix dw = args(17).matrix_value ();
         
         const F77_INT iweight = args(18).int_value ();
         const F77_INT ijobc = args(19).int_value ();
@@ -280,8 +280,8 @@ For internal use only.")
         ldwork =  max (lminl, lminr, lrcf,
                        2*n*n + max (1, lleft, lright, 2*n*n+5*n, n*max (m, p)));
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT iwarn = 0;
@@ -289,31 +289,31 @@ For internal use only.")
 
 
         // SLICOT routine AB09ID
-        F77_XFCN (ab09id, AB09ID,
-                 (dico, jobc, jobo, job,
-                  weight, equil, ordsel,
-                  n, m, p,
-                  nv, pv, nw, mw,
-                  nr,
-                  alpha, alphac, alphao,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  av.fortran_vec (), ldav,
-                  bv.fortran_vec (), ldbv,
-                  cv.fortran_vec (), ldcv,
-                  dv.fortran_vec (), lddv,
-                  aw.fortran_vec (), ldaw,
-                  bw.fortran_vec (), ldbw,
-                  cw.fortran_vec (), ldcw,
-                  dw.fortran_vec (), lddw,
-                  ns,
-                  hsv.fortran_vec (),
-                  tol1, tol2,
-                  iwork,
-                  dwork, ldwork,
-                  iwarn, info));
+        CONTROL_XFCN (ab09id, AB09ID, (n, m, p, ldwork), (info, iwarn),
+                     (dico, jobc, jobo, job,
+                      weight, equil, ordsel,
+                      n, m, p,
+                      nv, pv, nw, mw,
+                      nr,
+                      alpha, alphac, alphao,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      av.fortran_vec (), ldav,
+                      bv.fortran_vec (), ldbv,
+                      cv.fortran_vec (), ldcv,
+                      control_input (dv), lddv,
+                      aw.fortran_vec (), ldaw,
+                      bw.fortran_vec (), ldbw,
+                      cw.fortran_vec (), ldcw,
+                      control_input (dw), lddw,
+                      ns,
+                      hsv.fortran_vec (),
+                      tol1, tol2,
+                      iwork,
+                      dwork, ldwork,
+                      iwarn, info));
 
         if (f77_exception_encountered)
             error ("modred: exception in SLICOT subroutine AB09ID");
@@ -23,7 +23,7 @@ Uses SLICOT AB09JD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: July 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -58,7 +58,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ab09jd__", "__control_slicot_functions__.oct");         
+// PKG_ADD: autoload ("__sl_ab09jd__", "__control_slicot_modred__.oct");         
 DEFUN_DLD (__sl_ab09jd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB09JD Release 5.0\n\
@@ -256,8 +256,8 @@ For internal use only.")
         
         ldwork = max (ldw1, ldw2, ldw3, ldw4);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT iwarn = 0;
@@ -265,30 +265,30 @@ For internal use only.")
 
 
         // SLICOT routine AB09JD
-        F77_XFCN (ab09jd, AB09JD,
-                 (jobv, jobw, jobinv,
-                  dico, equil, ordsel,
-                  n, nv, nw, m, p,
-                  nr,
-                  alpha,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  av.fortran_vec (), ldav,
-                  bv.fortran_vec (), ldbv,
-                  cv.fortran_vec (), ldcv,
-                  dv.fortran_vec (), lddv,
-                  aw.fortran_vec (), ldaw,
-                  bw.fortran_vec (), ldbw,
-                  cw.fortran_vec (), ldcw,
-                  dw.fortran_vec (), lddw,
-                  ns,
-                  hsv.fortran_vec (),
-                  tol1, tol2,
-                  iwork,
-                  dwork, ldwork,
-                  iwarn, info));
+        CONTROL_XFCN (ab09jd, AB09JD, (n, m, p, ldwork), (info, iwarn),
+                     (jobv, jobw, jobinv,
+                      dico, equil, ordsel,
+                      n, nv, nw, m, p,
+                      nr,
+                      alpha,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      av.fortran_vec (), ldav,
+                      bv.fortran_vec (), ldbv,
+                      cv.fortran_vec (), ldcv,
+                      dv.fortran_vec (), lddv,
+                      aw.fortran_vec (), ldaw,
+                      bw.fortran_vec (), ldbw,
+                      cw.fortran_vec (), ldcw,
+                      dw.fortran_vec (), lddw,
+                      ns,
+                      hsv.fortran_vec (),
+                      tol1, tol2,
+                      iwork,
+                      dwork, ldwork,
+                      iwarn, info));
 
         if (f77_exception_encountered)
             error ("hnamodred: exception in SLICOT subroutine AB09JD");
@@ -23,7 +23,7 @@ Uses SLICOT AB13AD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: January 2010
-Version: 0.4
+Version: 0.5
 
 */
 
@@ -45,7 +45,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ab13ad__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_ab13ad__", "__control_slicot_modred__.oct");    
 DEFUN_DLD (__sl_ab13ad__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB13AD Release 5.0\n\
@@ -99,24 +99,24 @@ For internal use only.")
         // workspace
         F77_INT ldwork = max (1, n*(max (n, m, p) + 5) + n*(n+1)/2);
         
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info = 0;
 
 
         // SLICOT routine AB13AD
-        F77_XFCN (ab13ad, AB13AD,
-                 (dico, equil,
-                  n, m, p,
-                  alpha,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  ns,
-                  hsv.fortran_vec (),
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (ab13ad, AB13AD, (n, m, p, ldwork), (info),
+                     (dico, equil,
+                      n, m, p,
+                      alpha,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      ns,
+                      hsv.fortran_vec (),
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("hsvd: __sl_ab13ad__: exception in SLICOT subroutine AB13AD");
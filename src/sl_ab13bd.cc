@@ -17,13 +17,13 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
 
-H-2 norm of a SS model.
+H-2 norm of a SS model, also for batches of models.
 Uses SLICOT AB13BD by courtesy of NICONET e.V.
 <http://www.slicot.org>
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: November 2009
-Version: 0.5
+Version: 0.6
 
 */
 
@@ -46,7 +46,94 @@ extern "C"
                      F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ab13bd__", "__control_slicot_functions__.oct");    
+// H-2 norm of one call of __sl_ab13bd__, see control_batch_item
+struct ab13bd_problem : control_batch_item
+{
+    ab13bd_problem (const octave_value_list& args, const std::string& who);
+    void run (bool worker);
+    octave_value_list result () const;
+
+    // arguments in
+    char dico;
+    char jobn = 'H';
+
+    Matrix a, b, c, d;
+    F77_INT n, m, p;
+
+    // arguments out
+    double norm = 0;
+    F77_INT nq = 0;
+};
+
+ab13bd_problem::ab13bd_problem (const octave_value_list& args, const std::string& who)
+{
+    a = args(0).matrix_value ();
+    b = args(1).matrix_value ();
+    c = args(2).matrix_value ();
+    d = args(3).matrix_value ();
+    F77_INT discrete = args(4).int_value ();
+
+    if (discrete == 0)
+        dico = 'C';
+    else
+        dico = 'D';
+    
+    n = TO_F77_INT (a.rows ());      // n: number of states
+    m = TO_F77_INT (b.columns ());   // m: number of inputs
+    p = TO_F77_INT (c.rows ());      // p: number of outputs
+
+    if (a.columns () != n || b.rows () != n || c.columns () != n
+        || d.rows () != p || d.columns () != m)
+        error ("%s: dimensions of A, B, C and D do not match", who.c_str ());
+
+    // a, b, c and d are overwritten, copies are made here
+    a.fortran_vec ();
+    b.fortran_vec ();
+    c.fortran_vec ();
+    d.fortran_vec ();
+}
+
+void ab13bd_problem::run (bool worker)
+{
+    F77_INT lda = max (1, TO_F77_INT (a.rows ()));
+    F77_INT ldb = max (1, TO_F77_INT (b.rows ()));
+    F77_INT ldc = max (1, TO_F77_INT (c.rows ()));
+    F77_INT ldd = max (1, TO_F77_INT (d.rows ()));
+    
+    // tolerance
+    double tol = 0;
+    
+    // workspace
+    F77_INT ldwork = max (1, m*(n+m) + max (n*(n+5), m*(m+2), 4*p ),
+                         n*(max (n, p) + 4 ) + min (n, p));
+
+    CONTROL_WORK_BUFFER (double, dwork, ldwork);
+
+    // SLICOT routine AB13BD, a function, called directly also for
+    // worker = false, see CONTROL_FCN_VALUE
+    CONTROL_FCN_VALUE (norm, ab13bd, AB13BD, (n, m, p, ldwork), (info, iwarn),
+                      (dico, jobn,
+                       n, m, p,
+                       a.fortran_vec (), lda,
+                       b.fortran_vec (), ldb,
+                       c.fortran_vec (), ldc,
+                       d.fortran_vec (), ldd,
+                       nq,
+                       tol,
+                       dwork, ldwork,
+                       iwarn,
+                       info));
+}
+
+octave_value_list ab13bd_problem::result () const
+{
+    return octave_value_list (octave_value (norm));
+}
+
+static const bool ab13bd_batch
+    = control_batch_register ("__sl_ab13bd__", 5, 5, control_batch_make<ab13bd_problem>);
+
+// PKG_ADD: autoload ("__sl_ab13bd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_ab13bd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB13BD Release 5.\n\
@@ -62,73 +149,21 @@ For internal use only.")
     }
     else
     {
-        // arguments in
-        char dico;
-        char jobn = 'H';
-        
-        Matrix a = args(0).matrix_value ();
-        Matrix b = args(1).matrix_value ();
-        Matrix c = args(2).matrix_value ();
-        Matrix d = args(3).matrix_value ();
-        F77_INT discrete = args(4).int_value ();
-
-        if (discrete == 0)
-            dico = 'C';
-        else
-            dico = 'D';
-        
-        F77_INT n = TO_F77_INT (a.rows ());      // n: number of states
-        F77_INT m = TO_F77_INT (b.columns ());   // m: number of inputs
-        F77_INT p = TO_F77_INT (c.rows ());      // p: number of outputs
-        
-        F77_INT lda = max (1, TO_F77_INT (a.rows ()));
-        F77_INT ldb = max (1, TO_F77_INT (b.rows ()));
-        F77_INT ldc = max (1, TO_F77_INT (c.rows ()));
-        F77_INT ldd = max (1, TO_F77_INT (d.rows ()));
-        
-        // arguments out
-        double norm;
-        F77_INT nq;
-        
-        // tolerance
-        double tol = 0;
-        
-        // workspace
-        F77_INT ldwork = max (1, m*(n+m) + max (n*(n+5), m*(m+2), 4*p ),
-                             n*(max (n, p) + 4 ) + min (n, p));
+        ab13bd_problem pr (args, "lti: norm: __sl_ab13bd__");
 
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        
-        // error indicator
-        F77_INT iwarn;
-        F77_INT info;
-
-
-        // SLICOT routine AB13BD
-        norm = F77_FUNC (ab13bd, AB13BD)
-                        (dico, jobn,
-                         n, m, p,
-                         a.fortran_vec (), lda,
-                         b.fortran_vec (), ldb,
-                         c.fortran_vec (), ldc,
-                         d.fortran_vec (), ldd,
-                         nq,
-                         tol,
-                         dwork, ldwork,
-                         iwarn,
-                         info);
+        pr.run (false);
 
         if (f77_exception_encountered)
             error ("lti: norm: __sl_ab13bd__: exception in SLICOT subroutine AB13BD");
             
-        if (info != 0)
-            error ("lti: norm: __sl_ab13bd__: AB13BD returned info = %d", static_cast<int> (info));
+        if (pr.info != 0)
+            error ("lti: norm: __sl_ab13bd__: AB13BD returned info = %d", static_cast<int> (pr.info));
 
-        if (iwarn != 0)
-            warning ("lti: norm: __sl_ab13bd__: AB13BD returned iwarn = %d", static_cast<int> (iwarn));
+        if (pr.iwarn != 0)
+            warning ("lti: norm: __sl_ab13bd__: AB13BD returned iwarn = %d", static_cast<int> (pr.iwarn));
         
         // return value
-        retval(0) = octave_value (norm);
+        retval = pr.result ();
     }
     
     return retval;
@@ -17,13 +17,13 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
 
-L-infinity norm of a SS model.
+L-infinity norm of a SS model, also for batches of models.
 Uses SLICOT AB13DD by courtesy of NICONET e.V.
 <http://www.slicot.org>
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: November 2009
-Version: 0.5
+Version: 0.8
 
 */
 
@@ -50,7 +50,131 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ab13dd__", "__control_slicot_functions__.oct");    
+// L-infinity norm of one call of __sl_ab13dd__, see control_batch_item
+struct ab13dd_problem : control_batch_item
+{
+    ab13dd_problem (const octave_value_list& args, const std::string& who);
+    void run (bool worker);
+    octave_value_list result () const;
+
+    // arguments in
+    char dico;
+    char jobe;
+    char equil;
+    char jobd = 'D';
+
+    Matrix a, e, b, c, d;
+    F77_INT n, m, p;
+    double tol;
+
+    // arguments out
+    ColumnVector fpeak, gpeak;
+
+    // workspace
+    F77_INT ldwork;
+};
+
+ab13dd_problem::ab13dd_problem (const octave_value_list& args, const std::string& who)
+{
+    a = args(0).matrix_value ();
+    e = args(1).matrix_value ();
+    b = args(2).matrix_value ();
+    c = args(3).matrix_value ();
+    d = args(4).matrix_value ();
+    F77_INT discrete = args(5).int_value ();
+    F77_INT descriptor = args(6).int_value ();
+    tol = args(7).double_value ();
+    const F77_INT scaled = args(8).int_value ();
+
+    if (discrete == 0)
+        dico = 'C';
+    else
+        dico = 'D';
+
+    if (descriptor == 0)
+        jobe = 'I';
+    else
+        jobe = 'G';
+
+    if (scaled == 0)
+        equil = 'S';
+    else
+        equil = 'N';
+
+    n = TO_F77_INT (a.rows ());      // n: number of states
+    m = TO_F77_INT (b.columns ());   // m: number of inputs
+    p = TO_F77_INT (c.rows ());      // p: number of outputs
+
+    if (a.columns () != n || b.rows () != n || c.columns () != n
+        || d.rows () != p || d.columns () != m
+        || (jobe == 'G' && (e.rows () != n || e.columns () != n)))
+        error ("%s: dimensions of A, B, C, D and E do not match", who.c_str ());
+
+    fpeak = ColumnVector (2);
+    gpeak = ColumnVector (2);
+
+    fpeak(0) = 0;
+    fpeak(1) = 1;
+
+    ldwork = control_ldwork ("AB13DD", {n, m, p},
+                             max (1, 15*n*n + p*p + m*m + (6*n+3)*(p+m) + 4*p*m +
+                                  n*m + 22*n + 7*min(p,m)), 2*n);
+
+    // a, e, b, c and d are overwritten, copies are made here
+    a.fortran_vec ();
+    e.fortran_vec ();
+    b.fortran_vec ();
+    c.fortran_vec ();
+    d.fortran_vec ();
+}
+
+void ab13dd_problem::run (bool worker)
+{
+    F77_INT lda = max (1, n);
+    F77_INT lde = max (1, n);
+    F77_INT ldb = max (1, n);
+    F77_INT ldc = max (1, p);
+    F77_INT ldd = max (1, p);
+
+    // workspace
+    F77_INT lcwork = max (1, (n+m)*(n+p) + 2*min(p,m) + max(p,m));
+
+    CONTROL_WORK_BUFFER (F77_INT, iwork, n);
+    CONTROL_WORK_BUFFER (double, dwork, ldwork);
+    CONTROL_WORK_BUFFER (Complex, cwork, lcwork);
+
+    // SLICOT routine AB13DD
+    CONTROL_CALL (worker, ab13dd, AB13DD, (n, m, p, ldwork), (info),
+                (dico, jobe,
+                 equil, jobd,
+                 n, m, p,
+                 fpeak.fortran_vec (),
+                 a.fortran_vec (), lda,
+                 e.fortran_vec (), lde,
+                 b.fortran_vec (), ldb,
+                 c.fortran_vec (), ldc,
+                 d.fortran_vec (), ldd,
+                 gpeak.fortran_vec (),
+                 tol,
+                 iwork, dwork, ldwork,
+                 cwork, lcwork,
+                 info));
+}
+
+octave_value_list ab13dd_problem::result () const
+{
+    octave_value_list retval;
+
+    retval(0) = fpeak;
+    retval(1) = gpeak;
+
+    return retval;
+}
+
+static const bool ab13dd_batch
+    = control_batch_register ("__sl_ab13dd__", 9, 9, control_batch_make<ab13dd_problem>);
+
+// PKG_ADD: autoload ("__sl_ab13dd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_ab13dd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AB13DD Release 5.0\n\
@@ -66,82 +190,9 @@ For internal use only.")
     }
     else
     {
-        // arguments in
-        char dico;
-        char jobe;
-        char equil;
-        char jobd = 'D';
-        
-        Matrix a = args(0).matrix_value ();
-        Matrix e = args(1).matrix_value ();
-        Matrix b = args(2).matrix_value ();
-        Matrix c = args(3).matrix_value ();
-        Matrix d = args(4).matrix_value ();
-        F77_INT discrete = args(5).int_value ();
-        F77_INT descriptor = args(6).int_value ();
-        double tol = args(7).double_value ();
-        const F77_INT scaled = args(8).int_value ();
-        
-        if (discrete == 0)
-            dico = 'C';
-        else
-            dico = 'D';
-
-        if (descriptor == 0)
-            jobe = 'I';
-        else
-            jobe = 'G';
-
-        if (scaled == 0)
-            equil = 'S';
-        else
-            equil = 'N';
-
-        F77_INT n = TO_F77_INT (a.rows ());      // n: number of states
-        F77_INT m = TO_F77_INT (b.columns ());   // m: number of inputs
-        F77_INT p = TO_F77_INT (c.rows ());      // p: number of outputs
-        
-        F77_INT lda = max (1, n);
-        F77_INT lde = max (1, n);
-        F77_INT ldb = max (1, n);
-        F77_INT ldc = max (1, p);
-        F77_INT ldd = max (1, p);
-        
-        ColumnVector fpeak (2);
-        ColumnVector gpeak (2);
-        
-        fpeak(0) = 0;
-        fpeak(1) = 1;
-        
-        // workspace
-        F77_INT ldwork = max (1, 15*n*n + p*p + m*m + (6*n+3)*(p+m) + 4*p*m +
-                          n*m + 22*n + 7*min(p,m));
-        F77_INT lcwork = max (1, (n+m)*(n+p) + 2*min(p,m) + max(p,m));
-        
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, n);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (Complex, cwork, lcwork);
-        
-        // error indicator
-        F77_INT info;
-
-
-        // SLICOT routine AB13DD
-        F77_XFCN (ab13dd, AB13DD,
-                 (dico, jobe,
-                  equil, jobd,
-                  n, m, p,
-                  fpeak.fortran_vec (),
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  gpeak.fortran_vec (),
-                  tol,
-                  iwork, dwork, ldwork,
-                  cwork, lcwork,
-                  info));
+        ab13dd_problem pr (args, "lti: norm: __sl_ab13dd__");
+
+        pr.run (false);
 
         if (f77_exception_encountered)
             error ("lti: norm: __sl_ab13dd__: exception in SLICOT subroutine AB13DD");
@@ -156,12 +207,11 @@ For internal use only.")
             "4: the tolerance is too small and the algorithm did "
                 "not converge"};
 
-        error_msg ("__sl_ab13dd__", info, 4, err_msg);
+        error_msg ("__sl_ab13dd__", pr.info, 4, err_msg);
 
         
         // return values
-        retval(0) = fpeak;
-        retval(1) = gpeak;
+        retval = pr.result ();
     }
     
     return retval;
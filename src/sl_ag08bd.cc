@@ -23,7 +23,7 @@ Uses SLICOT AG08BD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: September 2010
-Version: 0.5
+Version: 0.6
 
 */
 
@@ -63,7 +63,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ag08bd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_ag08bd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_ag08bd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot AG08BD Release 5.0\n\
@@ -118,16 +118,16 @@ For internal use only.")
         F77_INT ninfe;
         F77_INT nkrol;
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, infz, n+1);
-        OCTAVE_LOCAL_BUFFER (F77_INT, kronr, n+m+1);
-        OCTAVE_LOCAL_BUFFER (F77_INT, infe, 1 + min (l+p, n+m));
-        OCTAVE_LOCAL_BUFFER (F77_INT, kronl, l+p+1);
+        CONTROL_WORK_BUFFER (F77_INT, infz, n+1);
+        CONTROL_WORK_BUFFER (F77_INT, kronr, n+m+1);
+        CONTROL_WORK_BUFFER (F77_INT, infe, 1 + min (l+p, n+m));
+        CONTROL_WORK_BUFFER (F77_INT, kronl, l+p+1);
 
         // workspace
         F77_INT ldwork = max (l+p, m+n) * (m+n) + max (1, 5 * max (l+p, m+n));
         
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, n + max (1, m));
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, n + max (1, m));
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicator
         F77_INT info;
@@ -136,21 +136,21 @@ For internal use only.")
         double tol = 0;     // AG08BD uses DLAMCH for default tolerance
 
         // SLICOT routine AG08BD
-        F77_XFCN (ag08bd, AG08BD,
-                 (equil,
-                  l, n, m, p,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  nfz, nrank, niz, dinfz,
-                  nkror, ninfe, nkrol,
-                  infz,
-                  kronr, infe, kronl,
-                  tol,
-                  iwork, dwork, ldwork,
-                  info));
+        CONTROL_XFCN (ag08bd, AG08BD, (n, m, p, ldwork), (info),
+                     (equil,
+                      l, n, m, p,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      nfz, nrank, niz, dinfz,
+                      nkror, ninfe, nkrol,
+                      infz,
+                      kronr, infe, kronl,
+                      tol,
+                      iwork, dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("dss: zero: __sl_ag08bd__: exception in SLICOT subroutine AG08BD");
@@ -179,21 +179,21 @@ For internal use only.")
         F77_INT ldvr = 1;
         
         F77_INT lwork = max (1, 8*nfz);
-        OCTAVE_LOCAL_BUFFER (double, work, lwork);
+        CONTROL_WORK_BUFFER (double, work, lwork);
         
         F77_INT info2;
         
-        F77_XFCN (dggev, DGGEV,
-                 (jobvl, jobvr,
-                  nfz,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  alphar.fortran_vec (), alphai.fortran_vec (),
-                  beta.fortran_vec (),
-                  vl, ldvl,
-                  vr, ldvr,
-                  work, lwork,
-                  info2));
+        CONTROL_XFCN (dggev, DGGEV, (nfz, 0, 0, lwork), (info2),
+                     (jobvl, jobvr,
+                      nfz,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      alphar.fortran_vec (), alphai.fortran_vec (),
+                      beta.fortran_vec (),
+                      vl, ldvl,
+                      vr, ldvr,
+                      work, lwork,
+                      info2));
                                  
         if (f77_exception_encountered)
             error ("dss: zero: __sl_ag08bd__: exception in LAPACK subroutine DGGEV");
@@ -23,7 +23,7 @@ Uses SLICOT SB02RD and SB02MT by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: December 2012
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -72,7 +72,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_are__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_are__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_are__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB02RD Release 5.0\n\
@@ -129,14 +129,14 @@ For internal use only.")
         Matrix g (ldg, n);
 
         // unused output arguments
-        OCTAVE_LOCAL_BUFFER (F77_INT, ipiv, m);
+        CONTROL_WORK_BUFFER (F77_INT, ipiv, m);
         F77_INT oufact;
 
         // workspace
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork_a, m);
+        CONTROL_WORK_BUFFER (F77_INT, iwork_a, m);
 
         F77_INT ldwork_a = max (2, 3*m, n*m);
-        OCTAVE_LOCAL_BUFFER (double, dwork_a, ldwork_a);
+        CONTROL_WORK_BUFFER (double, dwork_a, ldwork_a);
 
 
         // error indicator
@@ -144,20 +144,20 @@ For internal use only.")
 
 
         // SLICOT routine SB02MT
-        F77_XFCN (sb02mt, SB02MT,
-                 (jobg, jobl,
-                  fact, uplo,
-                  n, m,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  q.fortran_vec (), ldq,
-                  r.fortran_vec (), ldr,
-                  l.fortran_vec (), ldl,
-                  ipiv, oufact,
-                  g.fortran_vec (), ldg,
-                  iwork_a,
-                  dwork_a, ldwork_a,
-                  info));
+        CONTROL_XFCN (sb02mt, SB02MT, (n, m, 0, ldwork_a), (info),
+                     (jobg, jobl,
+                      fact, uplo,
+                      n, m,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      q.fortran_vec (), ldq,
+                      r.fortran_vec (), ldr,
+                      l.fortran_vec (), ldl,
+                      ipiv, oufact,
+                      g.fortran_vec (), ldg,
+                      iwork_a,
+                      dwork_a, ldwork_a,
+                      info));
 
 
         if (f77_exception_encountered)
@@ -209,36 +209,36 @@ For internal use only.")
 
         // workspace
         F77_INT liwork_b = max (2*n, n*n);
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork_b, liwork_b);
+        CONTROL_WORK_BUFFER (F77_INT, iwork_b, liwork_b);
 
         F77_INT ldwork_b = 5 + max (1, 4*n*n + 8*n);
-        OCTAVE_LOCAL_BUFFER (double, dwork_b, ldwork_b);
+        CONTROL_WORK_BUFFER (double, dwork_b, ldwork_b);
 
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork_b, 2*n);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork_b, 2*n);
 
  
         // SLICOT routine SB02RD
-        F77_XFCN (sb02rd, SB02RD,
-                 (job, dico,
-                  hinv, trana,
-                  uplo, scal,
-                  sort, fact,
-                  lyapun,
-                  n,
-                  a.fortran_vec (), lda,
-                  t.fortran_vec (), ldt,
-                  v.fortran_vec (), ldv,
-                  g.fortran_vec (), ldg,
-                  q.fortran_vec (), ldq,
-                  x.fortran_vec (), ldx,
-                  sep,
-                  rcond, ferr,
-                  wr.fortran_vec (), wi.fortran_vec (),
-                  s.fortran_vec (), lds,
-                  iwork_b,
-                  dwork_b, ldwork_b,
-                  bwork_b,
-                  info));
+        CONTROL_XFCN (sb02rd, SB02RD, (n, 0, 0, ldwork_b), (info),
+                     (job, dico,
+                      hinv, trana,
+                      uplo, scal,
+                      sort, fact,
+                      lyapun,
+                      n,
+                      a.fortran_vec (), lda,
+                      t.fortran_vec (), ldt,
+                      v.fortran_vec (), ldv,
+                      g.fortran_vec (), ldg,
+                      q.fortran_vec (), ldq,
+                      x.fortran_vec (), ldx,
+                      sep,
+                      rcond, ferr,
+                      wr.fortran_vec (), wi.fortran_vec (),
+                      s.fortran_vec (), lds,
+                      iwork_b,
+                      dwork_b, ldwork_b,
+                      bwork_b,
+                      info));
 
 
         static const char* err_msg[] = {
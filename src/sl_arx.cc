@@ -0,0 +1,345 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Covariance matrices of the ARX regression problems for several
+structures (na, nb, nk) in one pass over the data.  For output i, the
+regressor of time t is
+
+    [ y_i(t-1) ... y_i(t-na)  u_1(t-nk-1) ... u_1(t-nk-nb_1)  ...  y_i(t) ]
+
+for t = max (na, nb) + nk, ..., N-1.  The covariance matrix of the largest
+structure is computed for the latest common start time T0 by the
+Toeplitz structure of the lagged signals,
+
+    G(j+1,k+1) = G(j,k) + a(T0-j-1) b(T0-k-1) - a(N-j-1) b(N-k-1),
+
+such that only the first row and column of every block need a pass over
+the data.  The matrix of a structure is a submatrix of it, plus the
+rows between the start time of the structure and T0.
+
+The data are either cells of matrices or the experiments of a binary
+iddata file, see iddataread, which are memory-mapped.
+
+Created: October 2026
+Version: 0.2
+
+*/
+
+#include <octave/oct.h>
+#include <octave/Cell.h>
+#include <octave/oct-map.h>
+#include "common.h"
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+// lagged signals of output i:  column c is sig[c](t - lag[c])
+struct arx_columns
+{
+    std::vector<const double*> sig;
+    std::vector<F77_INT> lag;
+};
+
+// covariance of the columns c1, c2 over the rows t0 <= t < t1
+static double
+arx_dot (const arx_columns& col, F77_INT c1, F77_INT c2, F77_INT t0, F77_INT t1)
+{
+    const double* a = col.sig[c1] - col.lag[c1];
+    const double* b = col.sig[c2] - col.lag[c2];
+    double sum = 0.0;
+
+    for (F77_INT t = t0; t < t1; t++)
+        sum += a[t] * b[t];
+
+    return sum;
+}
+
+// PKG_ADD: autoload ("__sl_arx__", "__control_slicot_ident__.oct");
+DEFUN_DLD (__sl_arx__, args, nargout,
+   "-*- texinfo -*-\n\
+Covariance matrices of ARX regression problems\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin != 5)
+    {
+        print_usage ();
+    }
+    else
+    {
+        // arguments in
+        const Matrix na = args(2).matrix_value ();      // p-by-K
+        const Matrix nb = args(3).matrix_value ();      // p*m-by-K, columns of nb(p-by-m)
+        const Matrix nk = args(4).matrix_value ();      // 1-by-K
+
+        F77_INT p = TO_F77_INT (na.rows ());
+        F77_INT nc = TO_F77_INT (na.columns ());        // number of structures
+        F77_INT n_exp;
+        F77_INT m;
+
+        // samples, outputs and inputs of every experiment
+        std::vector<F77_INT> ns;
+        std::vector<const double*> y;
+        std::vector<const double*> u;
+
+        std::vector<Matrix> mat;
+        std::vector<std::unique_ptr<control_mapped_file>> map;
+        std::vector<std::vector<double>> conv;
+
+        if (args(0).isstruct ())
+        {
+            // __sl_arx__ (src, [], na, nb, nk), one element per experiment
+            const octave_map src = args(0).map_value ();
+            const Cell file = src.contents ("file");
+            const Cell offset = src.contents ("offset");
+            const Cell nsmp = src.contents ("nsmp");
+            const Cell precision = src.contents ("precision");
+
+            n_exp = TO_F77_INT (src.numel ());
+            m = src.contents ("inputs").elem(0).int_value ();
+
+            for (F77_INT e = 0; e < n_exp; e++)
+            {
+                F77_INT n = nsmp.elem(e).int_value ();
+                double nval = static_cast<double> (n) * (p + m);
+                bool single = precision.elem(e).string_value () == "single";
+                double bytes = single ? sizeof (float) : sizeof (double);
+
+                map.emplace_back (new control_mapped_file (file.elem(e).string_value (),
+                                                           offset.elem(e).double_value (),
+                                                           nval * bytes));
+                const char* data = map.back ()->data ();
+
+                if (single)
+                {
+                    const float* f = reinterpret_cast<const float*> (data);
+                    conv.emplace_back (f, f + static_cast<size_t> (nval));
+                    data = reinterpret_cast<const char*> (conv.back ().data ());
+                    map.pop_back ();        // unmapped, the data are converted
+                }
+
+                const double* d = reinterpret_cast<const double*> (data);
+
+                ns.push_back (n);
+                y.push_back (d);
+                u.push_back (d + static_cast<size_t> (n) * p);
+            }
+        }
+        else
+        {
+            const Cell y_cell = args(0).cell_value ();
+            const Cell u_cell = args(1).cell_value ();
+
+            n_exp = TO_F77_INT (y_cell.numel ());
+            m = TO_F77_INT (u_cell.elem(0).columns ());
+
+            for (F77_INT e = 0; e < n_exp; e++)
+            {
+                mat.push_back (y_cell.elem(e).matrix_value ());
+                mat.push_back (u_cell.elem(e).matrix_value ());
+            }
+
+            for (F77_INT e = 0; e < n_exp; e++)
+            {
+                ns.push_back (TO_F77_INT (mat[2*e].rows ()));
+                y.push_back (mat[2*e].data ());
+                u.push_back (mat[2*e+1].data ());
+            }
+        }
+
+        Cell gram (p, nc);
+        Matrix nrows (p, nc, 0.0);
+
+        for (F77_INT i = 0; i < p; i++)
+        {
+            // largest structure and latest start time of output i
+            F77_INT ly = 0;
+            F77_INT lu = 0;
+            F77_INT t0max = 0;
+            std::vector<F77_INT> t0 (nc);
+
+            for (F77_INT k = 0; k < nc; k++)
+            {
+                F77_INT nak = static_cast<F77_INT> (na(i,k));
+                F77_INT nkk = static_cast<F77_INT> (nk(k));
+                F77_INT nbk = 0;
+
+                for (F77_INT x = 0; x < m; x++)
+                    nbk = max (nbk, static_cast<F77_INT> (nb(i + x*p, k)));
+
+                ly = max (ly, nak);
+                lu = max (lu, nbk + nkk);
+                t0[k] = max (nak, nbk) + nkk;
+                t0max = max (t0max, t0[k]);
+            }
+
+            // columns:  y_i lags 0..ly,  u_x lags 1..lu
+            F77_INT nl = ly + 1 + m*lu;
+            Matrix gmax (nl, nl, 0.0);
+
+            for (F77_INT e = 0; e < n_exp; e++)
+            {
+                octave_quit ();
+
+                F77_INT nsmp = ns[e];
+
+                if (nsmp <= t0max)
+                    continue;           // only rows before T0, see below
+
+                Matrix ge (nl, nl);
+
+                arx_columns col;
+                col.sig.resize (nl);
+                col.lag.resize (nl);
+
+                for (F77_INT j = 0; j <= ly; j++)
+                {
+                    col.sig[j] = y[e] + i*nsmp;
+                    col.lag[j] = j;
+                }
+
+                for (F77_INT x = 0; x < m; x++)
+                    for (F77_INT j = 1; j <= lu; j++)
+                    {
+                        col.sig[ly + x*lu + j] = u[e] + x*nsmp;
+                        col.lag[ly + x*lu + j] = j;
+                    }
+
+                // blocks of signal pairs, first row and column by a pass
+                // over the data, the rest by the Toeplitz recursion
+                std::vector<F77_INT> first (1 + m);
+                std::vector<F77_INT> len (1 + m);
+
+                first[0] = 0;
+                len[0] = ly + 1;
+
+                for (F77_INT x = 0; x < m; x++)
+                {
+                    first[1+x] = ly + 1 + x*lu;
+                    len[1+x] = lu;
+                }
+
+                for (F77_INT sa = 0; sa <= m; sa++)
+                    for (F77_INT sb = sa; sb <= m; sb++)
+                        for (F77_INT ja = 0; ja < len[sa]; ja++)
+                            for (F77_INT jb = (sa == sb ? ja : 0); jb < len[sb]; jb++)
+                            {
+                                F77_INT c1 = first[sa] + ja;
+                                F77_INT c2 = first[sb] + jb;
+                                double g;
+
+                                if (ja == 0 || jb == 0)
+                                    g = arx_dot (col, c1, c2, t0max, nsmp);
+                                else
+                                {
+                                    const double* a = col.sig[c1];
+                                    const double* b = col.sig[c2];
+                                    F77_INT l1 = col.lag[c1];
+                                    F77_INT l2 = col.lag[c2];
+
+                                    g = ge(c1-1, c2-1)
+                                        + a[t0max-l1] * b[t0max-l2]
+                                        - a[nsmp-l1] * b[nsmp-l2];
+                                }
+
+                                ge(c1,c2) = g;
+                                ge(c2,c1) = g;
+                            }
+
+                gmax += ge;
+            }
+
+            // structures:  submatrix of gmax plus the rows t0 <= t < T0
+            for (F77_INT k = 0; k < nc; k++)
+            {
+                F77_INT nak = static_cast<F77_INT> (na(i,k));
+                F77_INT nkk = static_cast<F77_INT> (nk(k));
+
+                std::vector<F77_INT> sel;
+
+                for (F77_INT j = 1; j <= nak; j++)
+                    sel.push_back (j);
+
+                for (F77_INT x = 0; x < m; x++)
+                {
+                    F77_INT nbx = static_cast<F77_INT> (nb(i + x*p, k));
+
+                    for (F77_INT j = nkk + 1; j <= nkk + nbx; j++)
+                        sel.push_back (ly + x*lu + j);
+                }
+
+                sel.push_back (0);      // y_i(t) last
+
+                F77_INT nsel = static_cast<F77_INT> (sel.size ());
+                Matrix g (nsel, nsel);
+
+                for (F77_INT c2 = 0; c2 < nsel; c2++)
+                    for (F77_INT c1 = 0; c1 < nsel; c1++)
+                        g(c1,c2) = gmax(sel[c1], sel[c2]);
+
+                double rows = 0.0;
+
+                for (F77_INT e = 0; e < n_exp; e++)
+                {
+                    F77_INT nsmp = ns[e];
+                    F77_INT t1 = min (t0max, nsmp);
+
+                    rows += max (0, nsmp - t0[k]);
+
+                    std::vector<double> z (nsel);
+                    const double* py = y[e] + i*nsmp;
+                    const double* pu = u[e];
+
+                    for (F77_INT t = t0[k]; t < t1; t++)
+                    {
+                        for (F77_INT c = 0; c < nsel; c++)
+                        {
+                            F77_INT s = sel[c];
+
+                            if (s <= ly)
+                                z[c] = py[t - s];
+                            else
+                            {
+                                F77_INT x = (s - ly - 1) / lu;
+                                F77_INT j = s - ly - x*lu;
+                                z[c] = pu[x*nsmp + t - j];
+                            }
+                        }
+
+                        for (F77_INT c2 = 0; c2 < nsel; c2++)
+                            for (F77_INT c1 = 0; c1 < nsel; c1++)
+                                g(c1,c2) += z[c1] * z[c2];
+                    }
+                }
+
+                gram(i,k) = g;
+                nrows(i,k) = rows;
+            }
+        }
+
+        // return values
+        retval(0) = gram;
+        retval(1) = nrows;
+    }
+
+    return retval;
+}
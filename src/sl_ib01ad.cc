@@ -23,7 +23,7 @@ Uses SLICOT IB01AD, IB01BD and IB01CD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: March 2012
-Version: 0.2
+Version: 0.4
 
 */
 
@@ -49,7 +49,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ib01ad__", "__control_slicot_functions__.oct");
+// PKG_ADD: autoload ("__sl_ib01ad__", "__control_slicot_ident__.oct");
 DEFUN_DLD (__sl_ib01ad__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot IB01AD Release 5.0\n\
@@ -59,7 +59,7 @@ For internal use only.")
     octave_idx_type nargin = args.length ();
     octave_value_list retval;
     
-    if (nargin != 10)
+    if (nargin < 10 || nargin > 11)
     {
         print_usage ();
     }
@@ -90,6 +90,9 @@ For internal use only.")
         double rcond = args(8).double_value ();
         double tol_a = args(9).double_value ();
 
+        // memory budget in bytes for the optional workspace, 0: no limit
+        double budget = (nargin > 10) ? args(10).double_value () : 0.0;
+
 //        double tol_b = rcond;
 //        doublet ol_c = rcond;
         
@@ -159,6 +162,8 @@ For internal use only.")
         Matrix r (ldr, 2*(m+l)*nobr);
         ColumnVector sv (l*nobr);
 
+        // the SAVEd state of IB01AD is overwritten, see control_ib01ad_begin
+        control_ib01ad_begin ();
 
         // repeat for every experiment in the dataset
         for (F77_INT i = 0; i < n_exp; i++)
@@ -286,7 +291,7 @@ For internal use only.")
             C     cache size is large enough to accommodate R, U, Y, and DWORK.
             */
 
-            ldwork_a = max (ldwork_a, (ns+2)*(2*(m+l)*nobr));
+            ldwork_a = control_workspace (ldwork_a, (ns+2.0)*(2*(m+l)*nobr), budget);
 
             /*
             IB01AD.f Lines 291-195:
@@ -301,8 +306,8 @@ For internal use only.")
             */
 
 
-            OCTAVE_LOCAL_BUFFER (F77_INT, iwork_a, liwork_a);
-            OCTAVE_LOCAL_BUFFER (double, dwork_a, ldwork_a);
+            CONTROL_WORK_BUFFER (F77_INT, iwork_a, liwork_a);
+            CONTROL_WORK_BUFFER (double, dwork_a, ldwork_a);
         
             // error indicators
             F77_INT iwarn_a = 0;
@@ -310,20 +315,20 @@ For internal use only.")
 
 
             // SLICOT routine IB01AD
-            F77_XFCN (ib01ad, IB01AD,
-                     (meth_a, alg, jobd,
-                      batch, conct, ctrl,
-                      nobr, m, l,
-                      nsmp,
-                      u.fortran_vec (), ldu,
-                      y.fortran_vec (), ldy,
-                      n,
-                      r.fortran_vec (), ldr,
-                      sv.fortran_vec (),
-                      rcond, tol_a,
-                      iwork_a,
-                      dwork_a, ldwork_a,
-                      iwarn_a, info_a));
+            CONTROL_XFCN (ib01ad, IB01AD, (nobr, m, l, ldwork_a), (info_a, iwarn_a),
+                         (meth_a, alg, jobd,
+                          batch, conct, ctrl,
+                          nobr, m, l,
+                          nsmp,
+                          u.fortran_vec (), ldu,
+                          y.fortran_vec (), ldy,
+                          n,
+                          r.fortran_vec (), ldr,
+                          sv.fortran_vec (),
+                          rcond, tol_a,
+                          iwork_a,
+                          dwork_a, ldwork_a,
+                          iwarn_a, info_a));
 
 
             if (f77_exception_encountered)
@@ -372,6 +377,13 @@ For internal use only.")
         // return values
         retval(0) = sv;
         retval(1) = octave_value (n);
+
+        // triangular factor for IB01BD
+        if (nargout > 2)
+        {
+            retval(2) = r;
+            retval(3) = octave_value (nsmpl);
+        }
     }
     
     return retval;
@@ -0,0 +1,437 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Estimate system matrices, Kalman gain and covariances from the
+processed triangular factor R of IB01AD, without access to the data.
+__sl_ib01bd_sweep__ estimates models of several orders from the same
+factor, one IB01BD call per order in parallel threads.  Unlike IB01AD,
+IB01BD keeps no state between calls, and every call works on its own
+copy of R, which IB01BD overwrites.
+Uses SLICOT IB01BD by courtesy of NICONET e.V.
+<http://www.slicot.org>
+
+Created: October 2026
+Version: 0.2
+
+*/
+
+#include <octave/oct.h>
+#include "common.h"
+#include <octave/Cell.h>
+#include <vector>
+#include <sstream>
+
+extern "C"
+{
+    int F77_FUNC (ib01bd, IB01BD)
+                 (char& METH, char& JOB, char& JOBCK,
+                  F77_INT& NOBR, F77_INT& N, F77_INT& M, F77_INT& L,
+                  F77_INT& NSMPL,
+                  double* R, F77_INT& LDR,
+                  double* A, F77_INT& LDA,
+                  double* C, F77_INT& LDC,
+                  double* B, F77_INT& LDB,
+                  double* D, F77_INT& LDD,
+                  double* Q, F77_INT& LDQ,
+                  double* RY, F77_INT& LDRY,
+                  double* S, F77_INT& LDS,
+                  double* K, F77_INT& LDK,
+                  double& TOL,
+                  F77_INT* IWORK,
+                  double* DWORK, F77_INT& LDWORK,
+                  F77_LOGICAL* BWORK,
+                  F77_INT& IWARN, F77_INT& INFO);
+}
+
+// estimate of IB01BD for one order, JOB = 'A', JOBCK = 'K'
+struct ib01bd_result
+{
+    Matrix a, b, c, d;
+    Matrix q, ry, s, k;
+    F77_INT iwarn;
+    F77_INT info;
+};
+
+static const char* ib01bd_err_msg[] = {
+    "0: OK",
+    "1: error message not specified",
+    "2: the singular value decomposition (SVD) algorithm did "
+        "not converge",
+    "3: a singular upper triangular matrix was found",
+    "4: matrix A is (numerically) singular in discrete-"
+        "time case",
+    "5: the Hamiltonian or symplectic matrix H cannot be "
+        "reduced to real Schur form",
+    "6: the real Schur form of the Hamiltonian or "
+        "symplectic matrix H cannot be appropriately ordered",
+    "7: the Hamiltonian or symplectic matrix H has less "
+        "than N stable eigenvalues",
+    "8: the N-th order system of linear algebraic "
+        "equations, from which the solution matrix X would "
+        "be obtained, is singular to working precision",
+    "9: the QR algorithm failed to complete the reduction "
+        "of the matrix Ac to Schur canonical form, T",
+    "10: the QR algorithm did not converge"};
+
+static const char* ib01bd_warn_msg[] = {
+    "0: OK",
+    "1: warning message not specified",
+    "2: warning message not specified",
+    "3: warning message not specified",
+    "4: a least squares problem to be solved has a "
+        "rank-deficient coefficient matrix",
+    "5: the computed covariance matrices are too small. "
+        "The problem seems to be a deterministic one; the "
+        "gain matrix is set to zero"};
+
+static char
+ib01bd_meth (F77_INT imeth)
+{
+    switch (imeth)
+    {
+        case 0:
+            return 'M';
+        case 1:
+            return 'N';
+        case 2:
+            return 'C';
+        default:
+            error ("__sl_ib01bd__: argument 'meth' invalid");
+    }
+}
+
+static void
+ib01bd_check (F77_INT ldr, octave_idx_type rc, F77_INT nobr, F77_INT n,
+              F77_INT m, F77_INT l, F77_INT nsmpl)
+{
+    if (ldr < 2*(m+l)*nobr || rc < 2*(m+l)*nobr)
+        error ("__sl_ib01bd__: R must be at least 2*(m+l)*nobr square");
+
+    if (n < 1 || n >= nobr)
+        error ("__sl_ib01bd__: require 0 < n < nobr");
+
+    if (nsmpl < 2*(m+l)*nobr)
+        error ("__sl_ib01bd__: nsmpl (%d) < 2*(m+l)*nobr (%d)",
+               static_cast<int> (nsmpl), static_cast<int> (2*(m+l)*nobr));
+}
+
+// run IB01BD for order n on the factor r (overwritten), the matrices
+// of res are allocated by the caller.  No calls into the interpreter,
+// such that it can be used by parallel_for with worker = true.
+static void
+ib01bd_estimate (ib01bd_result& res, double* r, F77_INT ldr,
+                 char meth_b, F77_INT nobr, F77_INT n, F77_INT m, F77_INT l,
+                 F77_INT nsmpl, double tol_b, double budget, bool worker)
+{
+    // arguments in
+    char job = 'A';
+    char jobck = 'K';
+
+    // arguments out
+    F77_INT lda = max (1, n);
+    F77_INT ldc = max (1, l);
+    F77_INT ldb = max (1, n);
+    F77_INT ldd = max (1, l);
+    F77_INT ldq = n;            // if JOBCK = 'C' or 'K'
+    F77_INT ldry = l;           // if JOBCK = 'C' or 'K'
+    F77_INT lds = n;            // if JOBCK = 'C' or 'K'
+    F77_INT ldk = n;            // if JOBCK = 'K'
+
+    // workspace
+    F77_INT liwork_b;
+    F77_INT liw1;
+    F77_INT liw2;
+
+    liw1 = max (n, m*nobr+n, l*nobr, m*(n+l));
+    liw2 = n*n;     // if JOBCK =  'K'
+    liwork_b = max (liw1, liw2);
+
+    F77_INT ldwork_b;
+    F77_INT ldw1;
+    F77_INT ldw2;
+    F77_INT ldw3;
+
+    if (meth_b == 'M')
+    {
+        F77_INT ldw1a = max (2*(l*nobr-l)*n+2*n, (l*nobr-l)*n+n*n+7*n);
+        F77_INT ldw1b = max (2*(l*nobr-l)*n+n*n+7*n,
+                         (l*nobr-l)*n+n+6*m*nobr,
+                         (l*nobr-l)*n+n+max (l+m*nobr, l*nobr + max (3*l*nobr+1, m)));
+        ldw1 = max (ldw1a, ldw1b);
+
+        F77_INT aw;
+
+        if (m == 0 || job == 'C')
+            aw = n + n*n;
+        else
+            aw = 0;
+
+        ldw2 = l*nobr*n + max ((l*nobr-l)*n+aw+2*n+max(5*n,(2*m+l)*nobr+l), 4*(m*nobr+n)+1, m*nobr+2*n+l );
+    }
+    else if (meth_b == 'N')
+    {
+        ldw1 = l*nobr*n + max ((l*nobr-l)*n+2*n+(2*m+l)*nobr+l,
+                               2*(l*nobr-l)*n+n*n+8*n,
+                               n+4*(m*nobr+n)+1,
+                               m*nobr+3*n+l);
+
+        if (m == 0 || job == 'C')
+            ldw2 = 0;
+        else
+            ldw2 = l*nobr*n+m*nobr*(n+l)*(m*(n+l)+1)+ max ((n+l)*(n+l), 4*m*(n+l)+1);
+
+    }
+    else    // (meth_b == 'C')
+    {
+        F77_INT ldw1a = max (2*(l*nobr-l)*n+2*n, (l*nobr-l)*n+n*n+7*n);
+        F77_INT ldw1b = l*nobr*n + max ((l*nobr-l)*n+2*n+(2*m+l)*nobr+l,
+                                    2*(l*nobr-l)*n+n*n+8*n,
+                                    n+4*(m*nobr+n)+1,
+                                    m*nobr+3*n+l);
+
+        ldw1 = max (ldw1a, ldw1b);
+
+        ldw2 = l*nobr*n+m*nobr*(n+l)*(m*(n+l)+1)+ max ((n+l)*(n+l), 4*m*(n+l)+1);
+
+    }
+
+    ldw3 = max(4*n*n + 2*n*l + l*l + max (3*l, n*l), 14*n*n + 12*n + 5);
+    ldwork_b = max (ldw1, ldw2, ldw3);
+
+    // IB01BD.f:  for good performance, LDWORK should be larger.
+    // Leave room for blocked QR factorizations of the columns of R.
+    ldwork_b = control_workspace (ldwork_b, ldwork_b + 64.0*2*(m+l)*nobr, budget);
+
+    std::vector<F77_INT> iwork_b (liwork_b);
+    std::vector<double> dwork_b (ldwork_b);
+    std::vector<F77_LOGICAL> bwork (2*n);
+
+    // error indicators
+    res.iwarn = 0;
+    res.info = 0;
+
+    // SLICOT routine IB01BD
+    CONTROL_CALL (worker, ib01bd, IB01BD, (n, m, l, ldwork_b), (res.info, res.iwarn),
+                 (meth_b, job, jobck,
+                  nobr, n, m, l,
+                  nsmpl,
+                  r, ldr,
+                  res.a.fortran_vec (), lda,
+                  res.c.fortran_vec (), ldc,
+                  res.b.fortran_vec (), ldb,
+                  res.d.fortran_vec (), ldd,
+                  res.q.fortran_vec (), ldq,
+                  res.ry.fortran_vec (), ldry,
+                  res.s.fortran_vec (), lds,
+                  res.k.fortran_vec (), ldk,
+                  tol_b,
+                  iwork_b.data (),
+                  dwork_b.data (), ldwork_b,
+                  bwork.data (),
+                  res.iwarn, res.info));
+}
+
+// allocate the results of order n
+static void
+ib01bd_alloc (ib01bd_result& res, F77_INT n, F77_INT m, F77_INT l)
+{
+    res.a = Matrix (max (1, n), n);
+    res.c = Matrix (max (1, l), n);
+    res.b = Matrix (max (1, n), m);
+    res.d = Matrix (max (1, l), m);
+
+    res.q = Matrix (n, n);
+    res.ry = Matrix (l, l);
+    res.s = Matrix (n, l);
+    res.k = Matrix (n, l);
+}
+
+// resize
+static void
+ib01bd_resize (ib01bd_result& res, F77_INT n, F77_INT m, F77_INT l)
+{
+    res.a.resize (n, n);
+    res.c.resize (l, n);
+    res.b.resize (n, m);
+    res.d.resize (l, m);
+
+    res.q.resize (n, n);
+    res.ry.resize (l, l);
+    res.s.resize (n, l);
+    res.k.resize (n, l);
+}
+
+// PKG_ADD: autoload ("__sl_ib01bd__", "__control_slicot_ident__.oct");
+DEFUN_DLD (__sl_ib01bd__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot IB01BD Release 5.0\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin < 8 || nargin > 9)
+    {
+        print_usage ();
+    }
+    else
+    {
+        Matrix r = args(0).matrix_value ();
+        F77_INT nobr = args(1).int_value ();
+        F77_INT n = args(2).int_value ();
+        F77_INT m = args(3).int_value ();
+        F77_INT l = args(4).int_value ();
+        F77_INT nsmpl = args(5).int_value ();
+        const F77_INT imeth = args(6).int_value ();
+        double tol_b = args(7).double_value ();
+        double budget = (nargin > 8) ? args(8).double_value () : 0.0;
+
+        char meth_b = ib01bd_meth (imeth);
+
+        // r as returned by the last IB01AD call, leading dimension unchanged
+        F77_INT ldr = TO_F77_INT (r.rows ());
+
+        ib01bd_check (ldr, r.columns (), nobr, n, m, l, nsmpl);
+
+        ib01bd_result res;
+        ib01bd_alloc (res, n, m, l);
+
+        ib01bd_estimate (res, r.fortran_vec (), ldr,
+                         meth_b, nobr, n, m, l, nsmpl, tol_b, budget, false);
+
+        if (f77_exception_encountered)
+            error ("ident: exception in SLICOT subroutine IB01BD");
+
+        error_msg ("ident: IB01BD", res.info, 10, ib01bd_err_msg);
+        warning_msg ("ident: IB01BD", res.iwarn, 5, ib01bd_warn_msg);
+
+        ib01bd_resize (res, n, m, l);
+
+        // return values
+        retval(0) = res.a;
+        retval(1) = res.b;
+        retval(2) = res.c;
+        retval(3) = res.d;
+
+        retval(4) = res.q;
+        retval(5) = res.ry;
+        retval(6) = res.s;
+        retval(7) = res.k;
+    }
+
+    return retval;
+}
+
+// PKG_ADD: autoload ("__sl_ib01bd_sweep__", "__control_slicot_ident__.oct");
+DEFUN_DLD (__sl_ib01bd_sweep__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot IB01BD Release 5.0 for several orders\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin < 9 || nargin > 10)
+    {
+        print_usage ();
+    }
+    else
+    {
+        const Matrix r = args(0).matrix_value ();
+        F77_INT nobr = args(1).int_value ();
+        const Array<octave_idx_type> orders = args(2).octave_idx_type_vector_value ();
+        F77_INT m = args(3).int_value ();
+        F77_INT l = args(4).int_value ();
+        F77_INT nsmpl = args(5).int_value ();
+        const F77_INT imeth = args(6).int_value ();
+        double tol_b = args(7).double_value ();
+        int nthreads = args(8).int_value ();
+        double budget = (nargin > 9) ? args(9).double_value () : 0.0;
+
+        char meth_b = ib01bd_meth (imeth);
+
+        F77_INT ldr = TO_F77_INT (r.rows ());
+        octave_idx_type rc = r.columns ();
+        octave_idx_type no = orders.numel ();
+
+        // check and allocate in the interpreter thread
+        std::vector<ib01bd_result> res (no);
+
+        for (octave_idx_type i = 0; i < no; i++)
+        {
+            F77_INT n = TO_F77_INT (orders(i));
+            ib01bd_check (ldr, rc, nobr, n, m, l, nsmpl);
+            ib01bd_alloc (res[i], n, m, l);
+        }
+
+        const double* pr = r.data ();
+        size_t len = static_cast<size_t> (ldr) * rc;
+
+        parallel_for (no, nthreads, [&] (octave_idx_type i)
+        {
+            // IB01BD overwrites R
+            std::vector<double> rw (pr, pr + len);
+
+            ib01bd_estimate (res[i], rw.data (), ldr,
+                             meth_b, nobr, TO_F77_INT (orders(i)), m, l,
+                             nsmpl, tol_b, budget / control_threads (nthreads), true);
+        });
+
+        Cell a (1, no), b (1, no), c (1, no), d (1, no);
+        Cell q (1, no), ry (1, no), s (1, no), k (1, no);
+
+        for (octave_idx_type i = 0; i < no; i++)
+        {
+            F77_INT n = TO_F77_INT (orders(i));
+
+            std::ostringstream os;
+            os << "ident: IB01BD (n = " << n << ")";
+
+            error_msg (os.str ().c_str (), res[i].info, 10, ib01bd_err_msg);
+            warning_msg (os.str ().c_str (), res[i].iwarn, 5, ib01bd_warn_msg);
+
+            ib01bd_resize (res[i], n, m, l);
+
+            a(i) = res[i].a;
+            b(i) = res[i].b;
+            c(i) = res[i].c;
+            d(i) = res[i].d;
+
+            q(i) = res[i].q;
+            ry(i) = res[i].ry;
+            s(i) = res[i].s;
+            k(i) = res[i].k;
+        }
+
+        // return values
+        retval(0) = a;
+        retval(1) = b;
+        retval(2) = c;
+        retval(3) = d;
+
+        retval(4) = q;
+        retval(5) = ry;
+        retval(6) = s;
+        retval(7) = k;
+    }
+
+    return retval;
+}
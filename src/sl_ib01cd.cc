@@ -23,7 +23,7 @@ Uses IB01CD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: May 2012
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -51,7 +51,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ib01cd__", "__control_slicot_functions__.oct");
+// PKG_ADD: autoload ("__sl_ib01cd__", "__control_slicot_ident__.oct");
 DEFUN_DLD (__sl_ib01cd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot IB01CD Release 5.0\n\
@@ -133,30 +133,30 @@ For internal use only.")
 
             ldwork_c = ldw1_c + n*( n + m + l ) + max (5*n, ldw1_c, min (ldw2_c, ldw3_c));
 
-            OCTAVE_LOCAL_BUFFER (F77_INT, iwork_c, liwork_c);
-            OCTAVE_LOCAL_BUFFER (double, dwork_c, ldwork_c);
+            CONTROL_WORK_BUFFER (F77_INT, iwork_c, liwork_c);
+            CONTROL_WORK_BUFFER (double, dwork_c, ldwork_c);
 
             // error indicators
             F77_INT iwarn_c = 0;
             F77_INT info_c = 0;
 
             // SLICOT routine IB01CD
-            F77_XFCN (ib01cd, IB01CD,
-                     (jobx0, comuse, jobbd,
-                      n, m, l,
-                      nsmp,
-                      a.fortran_vec (), lda,
-                      b.fortran_vec (), ldb,
-                      c.fortran_vec (), ldc,
-                      d.fortran_vec (), ldd,
-                      u.fortran_vec (), ldu,
-                      y.fortran_vec (), ldy,
-                      x0.fortran_vec (),
-                      v.fortran_vec (), ldv,
-                      tol_c,
-                      iwork_c,
-                      dwork_c, ldwork_c,
-                      iwarn_c, info_c));
+            CONTROL_XFCN (ib01cd, IB01CD, (n, m, l, ldwork_c), (info_c, iwarn_c),
+                         (jobx0, comuse, jobbd,
+                          n, m, l,
+                          nsmp,
+                          a.fortran_vec (), lda,
+                          b.fortran_vec (), ldb,
+                          c.fortran_vec (), ldc,
+                          d.fortran_vec (), ldd,
+                          u.fortran_vec (), ldu,
+                          y.fortran_vec (), ldy,
+                          x0.fortran_vec (),
+                          v.fortran_vec (), ldv,
+                          tol_c,
+                          iwork_c,
+                          dwork_c, ldwork_c,
+                          iwarn_c, info_c));
 
 
             if (f77_exception_encountered)
@@ -0,0 +1,372 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Preprocessing pipeline for iddata sets.  Every channel of every
+experiment is read once, passed through the list of stages
+
+    detrend    remove the least-squares fit of a polynomial of order ord
+    filter     direct form II transposed, like Octave's filter
+    resample   polyphase FIR resampling by p/q, like resample of the
+               signal package (upfirdn of the zero-padded filter)
+    nkshift    shorten outputs and inputs by nk samples, like nkshift
+
+in a private buffer and written once to the result.  The channels are
+processed in parallel.
+
+Created: October 2026
+Version: 0.1
+
+*/
+
+#include <octave/oct.h>
+#include <octave/Cell.h>
+#include <octave/ov-struct.h>
+#include "common.h"
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+enum pipeline_type { pipeline_detrend, pipeline_filter, pipeline_resample, pipeline_nkshift };
+
+struct pipeline_stage
+{
+    pipeline_type type;
+    F77_INT ord;                        // detrend
+    std::vector<double> b, a, si;       // filter
+    F77_INT p, q;                       // resample
+    std::vector<double> h;
+    F77_INT nk;                         // nkshift
+};
+
+static std::vector<double>
+pipeline_vector (const octave_scalar_map& map, const std::string& key)
+{
+    const Matrix v = map.getfield (key).matrix_value ();
+    return std::vector<double> (v.data (), v.data () + v.numel ());
+}
+
+// number of samples after all stages
+static F77_INT
+pipeline_length (const std::vector<pipeline_stage>& stage, F77_INT n)
+{
+    for (const auto& s : stage)
+    {
+        if (s.type == pipeline_resample)
+            n = static_cast<F77_INT> ((static_cast<double> (n) * s.p + s.q - 1) / s.q);
+        else if (s.type == pipeline_nkshift)
+            n = max (0, n - std::abs (s.nk));
+    }
+
+    return n;
+}
+
+// x - Q*Q'*x, Q orthonormal basis of the polynomials of order ord on
+// t in [-1, 1], built from q(j) = t.*q(j-1) by Gram-Schmidt with
+// reorthogonalization
+static void
+pipeline_detrend_channel (std::vector<double>& x, F77_INT ord, std::vector<double>& basis)
+{
+    F77_INT n = static_cast<F77_INT> (x.size ());
+    F77_INT k = min (ord + 1, n);
+
+    if (k == n)
+    {
+        std::fill (x.begin (), x.end (), 0.0);      // exact fit
+        return;
+    }
+
+    basis.resize (static_cast<size_t> (n) * k);
+    double dt = 2.0 / (n - 1);
+
+    for (F77_INT j = 0; j < k; j++)
+    {
+        double* v = basis.data () + static_cast<size_t> (j) * n;
+
+        for (F77_INT t = 0; t < n; t++)
+            v[t] = (j == 0) ? 1.0 : (t * dt - 1.0) * v[t - n];
+
+        for (int pass = 0; pass < 2; pass++)
+            for (F77_INT i = 0; i < j; i++)
+            {
+                const double* w = basis.data () + static_cast<size_t> (i) * n;
+                double dot = 0.0;
+
+                for (F77_INT t = 0; t < n; t++)
+                    dot += w[t] * v[t];
+
+                for (F77_INT t = 0; t < n; t++)
+                    v[t] -= dot * w[t];
+            }
+
+        double nrm = 0.0;
+
+        for (F77_INT t = 0; t < n; t++)
+            nrm += v[t] * v[t];
+
+        nrm = std::sqrt (nrm);
+
+        for (F77_INT t = 0; t < n; t++)
+            v[t] /= nrm;
+    }
+
+    for (F77_INT j = 0; j < k; j++)
+    {
+        const double* w = basis.data () + static_cast<size_t> (j) * n;
+        double dot = 0.0;
+
+        for (F77_INT t = 0; t < n; t++)
+            dot += w[t] * x[t];
+
+        for (F77_INT t = 0; t < n; t++)
+            x[t] -= dot * w[t];
+    }
+}
+
+static void
+pipeline_filter_channel (std::vector<double>& x, const pipeline_stage& s)
+{
+    size_t len = std::max (s.a.size (), s.b.size ());
+
+    if (len == 0)
+        return;
+
+    std::vector<double> b (len, 0.0);
+    std::vector<double> a (len, 0.0);
+    std::vector<double> z (len, 0.0);   // z[len-1] stays zero
+
+    for (size_t k = 0; k < s.b.size (); k++)
+        b[k] = s.b[k] / s.a[0];
+
+    for (size_t k = 0; k < s.a.size (); k++)
+        a[k] = s.a[k] / s.a[0];
+
+    for (size_t k = 0; k < s.si.size () && k + 1 < len; k++)
+        z[k] = s.si[k];
+
+    for (double& xt : x)
+    {
+        double in = xt;
+        double out = z[0] + b[0] * in;
+
+        for (size_t k = 1; k < len; k++)
+            z[k-1] = z[k] + b[k] * in - a[k] * out;
+
+        xt = out;
+    }
+}
+
+static void
+pipeline_resample_channel (std::vector<double>& x, const pipeline_stage& s,
+                           std::vector<double>& y)
+{
+    F77_INT lx = static_cast<F77_INT> (x.size ());
+    F77_INT lh = static_cast<F77_INT> (s.h.size ());
+    F77_INT p = s.p;
+    F77_INT q = s.q;
+    F77_INT ly = static_cast<F77_INT> ((static_cast<double> (lx) * p + q - 1) / q);
+
+    // delay compensation of resample.m, h is prepadded by nz_pre zeros
+    double l = (lh - 1) / 2.0;
+    F77_INT nz_pre = static_cast<F77_INT> (std::floor (q - std::fmod (l, q)));
+    F77_INT offset = static_cast<F77_INT> (std::floor ((l + nz_pre) / q));
+
+    y.assign (ly, 0.0);
+
+    for (F77_INT k = 0; k < ly; k++)
+    {
+        // sample n of the filtered, upsampled signal
+        double n = static_cast<double> (offset + k) * q - nz_pre;
+        F77_INT s_lo = static_cast<F77_INT> (std::ceil ((n - lh + 1) / p));
+        F77_INT s_hi = static_cast<F77_INT> (std::floor (n / p));
+        double sum = 0.0;
+
+        for (F77_INT i = max (s_lo, 0); i <= min (s_hi, lx - 1); i++)
+            sum += s.h[static_cast<F77_INT> (n) - i*p] * x[i];
+
+        y[k] = sum;
+    }
+
+    x.swap (y);
+}
+
+static void
+pipeline_channel (const double* in, F77_INT n, bool output,
+                  const std::vector<pipeline_stage>& stage, double* out)
+{
+    std::vector<double> x (in, in + n);
+    std::vector<double> work;
+
+    for (const auto& s : stage)
+    {
+        switch (s.type)
+        {
+            case pipeline_detrend:
+                pipeline_detrend_channel (x, s.ord, work);
+                break;
+
+            case pipeline_filter:
+                pipeline_filter_channel (x, s);
+                break;
+
+            case pipeline_resample:
+                pipeline_resample_channel (x, s, work);
+                break;
+
+            case pipeline_nkshift:
+            {
+                // outputs lose their first, inputs their last nk samples
+                F77_INT nk = min (std::abs (s.nk), static_cast<F77_INT> (x.size ()));
+
+                if ((s.nk >= 0) == output)
+                    x.erase (x.begin (), x.begin () + nk);
+                else
+                    x.resize (x.size () - nk);
+
+                break;
+            }
+        }
+    }
+
+    std::copy (x.begin (), x.end (), out);
+}
+
+// PKG_ADD: autoload ("__sl_iddata_pipeline__", "__control_slicot_ident__.oct");
+DEFUN_DLD (__sl_iddata_pipeline__, args, nargout,
+   "-*- texinfo -*-\n\
+Preprocessing pipeline for iddata sets\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin != 4)
+    {
+        print_usage ();
+    }
+    else
+    {
+        // arguments in
+        const Cell y_cell = args(0).cell_value ();
+        const Cell u_cell = args(1).cell_value ();
+        const Cell st_cell = args(2).cell_value ();
+        int nthreads = args(3).int_value ();
+
+        std::vector<pipeline_stage> stage (st_cell.numel ());
+
+        for (octave_idx_type k = 0; k < st_cell.numel (); k++)
+        {
+            const octave_scalar_map map = st_cell.elem(k).scalar_map_value ();
+            const std::string type = map.getfield ("type").string_value ();
+            pipeline_stage& s = stage[k];
+
+            if (type == "detrend")
+            {
+                s.type = pipeline_detrend;
+                s.ord = map.getfield ("ord").int_value ();
+            }
+            else if (type == "filter")
+            {
+                s.type = pipeline_filter;
+                s.b = pipeline_vector (map, "b");
+                s.a = pipeline_vector (map, "a");
+                s.si = pipeline_vector (map, "si");
+            }
+            else if (type == "resample")
+            {
+                s.type = pipeline_resample;
+                s.p = map.getfield ("p").int_value ();
+                s.q = map.getfield ("q").int_value ();
+                s.h = pipeline_vector (map, "h");
+            }
+            else if (type == "nkshift")
+            {
+                s.type = pipeline_nkshift;
+                s.nk = map.getfield ("nk").int_value ();
+            }
+            else
+                error ("__sl_iddata_pipeline__: unknown stage '%s'", type.c_str ());
+        }
+
+        F77_INT n_exp = TO_F77_INT (y_cell.numel ());
+
+        std::vector<Matrix> y (n_exp);
+        std::vector<Matrix> u (n_exp);
+        std::vector<Matrix> y_out (n_exp);
+        std::vector<Matrix> u_out (n_exp);
+        std::vector<double*> py_out (n_exp);
+        std::vector<double*> pu_out (n_exp);
+        std::vector<F77_INT> n_in (n_exp);
+        std::vector<F77_INT> n_out (n_exp);
+        std::vector<F77_INT> first (n_exp + 1, 0);
+
+        // one allocation per result, channels are written in place
+        for (F77_INT e = 0; e < n_exp; e++)
+        {
+            y[e] = y_cell.elem(e).matrix_value ();
+            u[e] = u_cell.elem(e).matrix_value ();
+
+            n_in[e] = TO_F77_INT (y[e].rows ());
+            n_out[e] = pipeline_length (stage, n_in[e]);
+
+            y_out[e] = Matrix (n_out[e], y[e].columns ());
+            u_out[e] = Matrix (n_out[e], u[e].columns ());
+            py_out[e] = y_out[e].fortran_vec ();
+            pu_out[e] = u_out[e].fortran_vec ();
+
+            first[e+1] = first[e] + TO_F77_INT (y[e].columns () + u[e].columns ());
+        }
+
+        // one task per channel
+        parallel_for (first[n_exp], nthreads, [&] (octave_idx_type i)
+        {
+            F77_INT e = static_cast<F77_INT> (std::upper_bound (first.begin (), first.end (), i)
+                                              - first.begin () - 1);
+            F77_INT c = static_cast<F77_INT> (i - first[e]);
+            F77_INT p = static_cast<F77_INT> (y[e].columns ());
+            bool output = c < p;
+
+            if (! output)
+                c -= p;
+
+            const double* in = (output ? y[e].data () : u[e].data ())
+                               + static_cast<size_t> (c) * n_in[e];
+            double* out = (output ? py_out[e] : pu_out[e])
+                          + static_cast<size_t> (c) * n_out[e];
+
+            pipeline_channel (in, n_in[e], output, stage, out);
+        });
+
+        Cell y_ret (y_cell.dims ());
+        Cell u_ret (u_cell.dims ());
+
+        for (F77_INT e = 0; e < n_exp; e++)
+        {
+            y_ret(e) = y_out[e];
+            u_ret(e) = u_out[e];
+        }
+
+        // return values
+        retval(0) = y_ret;
+        retval(1) = u_ret;
+    }
+
+    return retval;
+}
@@ -23,7 +23,7 @@ Uses SLICOT IB01AD, IB01BD and IB01CD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: March 2012
-Version: 0.2
+Version: 0.6
 
 */
 
@@ -85,7 +85,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_ident__", "__control_slicot_functions__.oct");
+// PKG_ADD: autoload ("__sl_ident__", "__control_slicot_ident__.oct");
 DEFUN_DLD (__sl_ident__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot IB01AD Release 5.0\n\
@@ -95,7 +95,7 @@ For internal use only.")
     octave_idx_type nargin = args.length ();
     octave_value_list retval;
     
-    if (nargin != 10)
+    if (nargin < 10 || nargin > 11)
     {
         print_usage ();
     }
@@ -127,6 +127,9 @@ For internal use only.")
         double rcond = args(8).double_value ();
         double tol_a = args(9).double_value ();
 
+        // memory budget in bytes for the optional workspace, 0: no limit
+        double budget = (nargin > 10) ? args(10).double_value () : 0.0;
+
         double tol_b = rcond;
         double tol_c = rcond;
         
@@ -199,6 +202,8 @@ For internal use only.")
         Matrix r (ldr, 2*(m+l)*nobr);
         ColumnVector sv (l*nobr);
 
+        // the SAVEd state of IB01AD is overwritten, see control_ib01ad_begin
+        control_ib01ad_begin ();
 
         // repeat for every experiment in the dataset
         for (F77_INT i = 0; i < n_exp; i++)
@@ -212,8 +217,8 @@ For internal use only.")
             else
                 batch = 'I';        // intermediate block
       
-            Matrix y = y_cell.elem(i).matrix_value ();
-            Matrix u = u_cell.elem(i).matrix_value ();
+            const Matrix y = y_cell.elem(i).matrix_value ();
+            const Matrix u = u_cell.elem(i).matrix_value ();
 
             // y.rows == u.rows  is checked by iddata class
             // F77_INT m = TO_F77_INT (u.columns ());   // m: number of inputs
@@ -326,7 +331,7 @@ For internal use only.")
             C     cache size is large enough to accommodate R, U, Y, and DWORK.
             */
 
-            ldwork_a = max (ldwork_a, (ns+2)*(2*(m+l)*nobr));
+            ldwork_a = control_workspace (ldwork_a, (ns+2.0)*(2*(m+l)*nobr), budget);
 
             /*
             IB01AD.f Lines 291-195:
@@ -341,8 +346,8 @@ For internal use only.")
             */
 
 
-            OCTAVE_LOCAL_BUFFER (F77_INT, iwork_a, liwork_a);
-            OCTAVE_LOCAL_BUFFER (double, dwork_a, ldwork_a);
+            CONTROL_WORK_BUFFER (F77_INT, iwork_a, liwork_a);
+            CONTROL_WORK_BUFFER (double, dwork_a, ldwork_a);
         
             // error indicators
             F77_INT iwarn_a = 0;
@@ -350,20 +355,20 @@ For internal use only.")
 
 
             // SLICOT routine IB01AD
-            F77_XFCN (ib01ad, IB01AD,
-                     (meth_a, alg, jobd,
-                      batch, conct, ctrl,
-                      nobr, m, l,
-                      nsmp,
-                      u.fortran_vec (), ldu,
-                      y.fortran_vec (), ldy,
-                      n,
-                      r.fortran_vec (), ldr,
-                      sv.fortran_vec (),
-                      rcond, tol_a,
-                      iwork_a,
-                      dwork_a, ldwork_a,
-                      iwarn_a, info_a));
+            CONTROL_XFCN (ib01ad, IB01AD, (nobr, m, l, ldwork_a), (info_a, iwarn_a),
+                         (meth_a, alg, jobd,
+                          batch, conct, ctrl,
+                          nobr, m, l,
+                          nsmp,
+                          control_input (u), ldu,
+                          control_input (y), ldy,
+                          n,
+                          r.fortran_vec (), ldr,
+                          sv.fortran_vec (),
+                          rcond, tol_a,
+                          iwork_a,
+                          dwork_a, ldwork_a,
+                          iwarn_a, info_a));
 
 
             if (f77_exception_encountered)
@@ -404,9 +409,15 @@ For internal use only.")
         }
 
 
-        // resize
+        // resize, IB01BD requires only LDR >= 2*(M+L)*NOBR
         F77_INT rs = 2*(m+l)*nobr;
         r.resize (rs, rs);
+        ldr = rs;
+
+        // factor and order estimate of IB01AD for later reuse,
+        // IB01BD overwrites parts of r
+        const Matrix r_fac = r;
+        const F77_INT n_est = n;
         
         if (nuser > 0)
         {
@@ -513,11 +524,15 @@ For internal use only.")
             
         ldw3 = max(4*n*n + 2*n*l + l*l + max (3*l, n*l), 14*n*n + 12*n + 5);
         ldwork_b = max (ldw1, ldw2, ldw3);
+
+        // IB01BD.f:  for good performance, LDWORK should be larger.
+        // Leave room for blocked QR factorizations of the columns of R.
+        ldwork_b = control_workspace (ldwork_b, ldwork_b + 64.0*2*(m+l)*nobr, budget);
         
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork_b, liwork_b);
-        OCTAVE_LOCAL_BUFFER (double, dwork_b, ldwork_b);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork_b, liwork_b);
+        CONTROL_WORK_BUFFER (double, dwork_b, ldwork_b);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
 
 
         // error indicators
@@ -526,24 +541,24 @@ For internal use only.")
 
 
         // SLICOT routine IB01BD
-        F77_XFCN (ib01bd, IB01BD,
-                 (meth_b, job, jobck,
-                  nobr, n, m, l,
-                  nsmpl,
-                  r.fortran_vec (), ldr,
-                  a.fortran_vec (), lda,
-                  c.fortran_vec (), ldc,
-                  b.fortran_vec (), ldb,
-                  d.fortran_vec (), ldd,
-                  q.fortran_vec (), ldq,
-                  ry.fortran_vec (), ldry,
-                  s.fortran_vec (), lds,
-                  k.fortran_vec (), ldk,
-                  tol_b,
-                  iwork_b,
-                  dwork_b, ldwork_b,
-                  bwork,
-                  iwarn_b, info_b));
+        CONTROL_XFCN (ib01bd, IB01BD, (n, m, l, ldwork_b), (info_b, iwarn_b),
+                     (meth_b, job, jobck,
+                      nobr, n, m, l,
+                      nsmpl,
+                      r.fortran_vec (), ldr,
+                      a.fortran_vec (), lda,
+                      c.fortran_vec (), ldc,
+                      b.fortran_vec (), ldb,
+                      d.fortran_vec (), ldd,
+                      q.fortran_vec (), ldq,
+                      ry.fortran_vec (), ldry,
+                      s.fortran_vec (), lds,
+                      k.fortran_vec (), ldk,
+                      tol_b,
+                      iwork_b,
+                      dwork_b, ldwork_b,
+                      bwork,
+                      iwarn_b, info_b));
 
 
         if (f77_exception_encountered)
@@ -612,8 +627,8 @@ For internal use only.")
         // compute individual initial state vector x0 for every experiment        
         for (F77_INT i = 0; i < n_exp; i++)
         {
-            Matrix y = y_cell.elem(i).matrix_value ();
-            Matrix u = u_cell.elem(i).matrix_value ();
+            const Matrix y = y_cell.elem(i).matrix_value ();
+            const Matrix u = u_cell.elem(i).matrix_value ();
             
             F77_INT nsmp = TO_F77_INT (y.rows ());   // nsmp: number of samples
             F77_INT ldv = max (1, n);
@@ -642,30 +657,30 @@ For internal use only.")
 
             ldwork_c = ldw1_c + n*( n + m + l ) + max (5*n, ldw1_c, min (ldw2_c, ldw3_c));
 
-            OCTAVE_LOCAL_BUFFER (F77_INT, iwork_c, liwork_c);
-            OCTAVE_LOCAL_BUFFER (double, dwork_c, ldwork_c);
+            CONTROL_WORK_BUFFER (F77_INT, iwork_c, liwork_c);
+            CONTROL_WORK_BUFFER (double, dwork_c, ldwork_c);
 
             // error indicators
             F77_INT iwarn_c = 0;
             F77_INT info_c = 0;
 
             // SLICOT routine IB01CD
-            F77_XFCN (ib01cd, IB01CD,
-                     (jobx0, comuse, jobbd,
-                      n, m, l,
-                      nsmp,
-                      a.fortran_vec (), lda,
-                      b.fortran_vec (), ldb,
-                      c.fortran_vec (), ldc,
-                      d.fortran_vec (), ldd,
-                      u.fortran_vec (), ldu,
-                      y.fortran_vec (), ldy,
-                      x0.fortran_vec (),
-                      v.fortran_vec (), ldv,
-                      tol_c,
-                      iwork_c,
-                      dwork_c, ldwork_c,
-                      iwarn_c, info_c));
+            CONTROL_XFCN (ib01cd, IB01CD, (n, m, l, ldwork_c), (info_c, iwarn_c),
+                         (jobx0, comuse, jobbd,
+                          n, m, l,
+                          nsmp,
+                          a.fortran_vec (), lda,
+                          b.fortran_vec (), ldb,
+                          c.fortran_vec (), ldc,
+                          d.fortran_vec (), ldd,
+                          control_input (u), ldu,
+                          control_input (y), ldy,
+                          x0.fortran_vec (),
+                          v.fortran_vec (), ldv,
+                          tol_c,
+                          iwork_c,
+                          dwork_c, ldwork_c,
+                          iwarn_c, info_c));
 
 
             if (f77_exception_encountered)
@@ -712,6 +727,14 @@ For internal use only.")
         retval(7) = k;
         
         retval(8) = x0_cell;
+
+        if (nargout > 9)
+        {
+            retval(9) = r_fac;
+            retval(10) = sv;
+            retval(11) = octave_value (nsmpl);
+            retval(12) = octave_value (n_est);
+        }
     }
     
     return retval;
@@ -0,0 +1,208 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Common parts of the parallel and the recursive data compression for
+subspace identification, __sl_ident_tsqr__ and __sl_ident_update__:
+the blocked QR factorization which adds rows to the triangular factor R
+of the block Hankel matrix, and the SVD (IB01ND) and order estimate
+(IB01OD) of the normalized factor, which together with IB01MD make up
+IB01AD.
+Uses SLICOT IB01ND and IB01OD by courtesy of NICONET e.V.
+<http://www.slicot.org>
+
+Created: October 2026
+Version: 0.1
+
+*/
+
+#include <octave/oct.h>
+#include "common.h"
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+extern "C"
+{
+    int F77_FUNC (dgeqrf, DGEQRF)
+                 (F77_INT& M, F77_INT& N,
+                  double* A, F77_INT& LDA,
+                  double* TAU,
+                  double* WORK, F77_INT& LWORK,
+                  F77_INT& INFO);
+
+    int F77_FUNC (ib01nd, IB01ND)
+                 (char& METH, char& JOBD,
+                  F77_INT& NOBR, F77_INT& M, F77_INT& L,
+                  double* R, F77_INT& LDR,
+                  double* SV,
+                  double& TOL,
+                  F77_INT* IWORK,
+                  double* DWORK, F77_INT& LDWORK,
+                  F77_INT& IWARN, F77_INT& INFO);
+
+    int F77_FUNC (ib01od, IB01OD)
+                 (char& CTRL,
+                  F77_INT& NOBR, F77_INT& L,
+                  double* SV,
+                  F77_INT& N,
+                  double& TOL,
+                  F77_INT& IWARN, F77_INT& INFO);
+}
+
+// QR factorization of the leading mrows rows of w (leading dimension ldw,
+// nr columns) by DGEQRF, the upper triangle is copied to the nr-by-nr
+// factor r.  worker = true in parallel_for, see CONTROL_CALL.
+// Returns INFO of DGEQRF.
+static F77_INT
+ident_factor_qr (double* w, F77_INT ldw, F77_INT mrows, F77_INT nr,
+                 double* r, bool worker)
+{
+    F77_INT info = 0;
+    F77_INT lwork = -1;
+    double wq;
+
+    std::vector<double> tau (nr);
+
+    CONTROL_CALL (worker, dgeqrf, DGEQRF, (mrows, nr, 0, 0), (info),
+                 (mrows, nr, w, ldw, tau.data (), &wq, lwork, info));
+
+    lwork = max (nr, static_cast<F77_INT> (wq));
+    std::vector<double> work (lwork);
+
+    CONTROL_CALL (worker, dgeqrf, DGEQRF, (mrows, nr, 0, lwork), (info),
+                 (mrows, nr, w, ldw, tau.data (), work.data (), lwork, info));
+
+    for (F77_INT j = 0; j < nr; j++)
+        for (F77_INT i = 0; i < nr; i++)
+            r[i + j*nr] = (i <= j && i < mrows) ? w[i + j*ldw] : 0.0;
+
+    return info;
+}
+
+// SVD and order estimate of the raw nr-by-nr factor r0 of nsl Hankel
+// rows.  r is the factor normalized like that of IB01MD, in the layout
+// of IB01AD, such that it can be used by IB01BD, sv the singular values
+// and n the estimated order.
+static void
+ident_factor_svd (const double* r0, F77_INT nsl,
+                  char meth, char ctrl, F77_INT nobr, F77_INT m, F77_INT l,
+                  double rcond, double tol,
+                  Matrix& r, ColumnVector& sv, F77_INT& n)
+{
+    char jobd = meth;                   // not relevant for METH = 'N'
+    F77_INT nr = 2*(m+l)*nobr;
+
+    // normalized factor in the layout of IB01AD
+    F77_INT ldr;
+
+    if (meth == 'M' && jobd == 'M')
+        ldr = max (nr, 3*m*nobr);
+    else
+        ldr = nr;
+
+    r = Matrix (ldr, nr, 0.0);
+    double scl = 1.0 / std::sqrt (static_cast<double> (nsl));
+
+    for (F77_INT j = 0; j < nr; j++)
+        for (F77_INT i = 0; i <= j; i++)
+            r(i,j) = scl * r0[i + j*nr];
+
+    // SLICOT routine IB01ND - singular value decomposition
+    sv = ColumnVector (l*nobr);
+
+    F77_INT liwork = max (1, (m+l)*nobr);
+    F77_INT ldwork;
+
+    if (meth == 'M' && jobd == 'M')
+        ldwork = max ((2*m-1)*nobr, (m+l)*nobr, 5*l*nobr);
+    else if (meth == 'M')
+        ldwork = 5*l*nobr;
+    else
+        ldwork = 5*(m+l)*nobr + 1;
+
+    CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+    CONTROL_WORK_BUFFER (double, dwork, ldwork);
+
+    F77_INT iwarn = 0;
+    F77_INT info = 0;
+
+    CONTROL_XFCN (ib01nd, IB01ND, (nobr, m, l, ldwork), (info, iwarn),
+                 (meth, jobd,
+                  nobr, m, l,
+                  r.fortran_vec (), ldr,
+                  sv.fortran_vec (),
+                  rcond,
+                  iwork,
+                  dwork, ldwork,
+                  iwarn, info));
+
+    if (f77_exception_encountered)
+        error ("ident: exception in SLICOT subroutine IB01ND");
+
+    static const char* err_msg[] = {
+        "0: OK",
+        "1: error message not specified",
+        "2: the singular value decomposition (SVD) algorithm did "
+            "not converge"};
+
+    static const char* warn_msg[] = {
+        "0: OK",
+        "1: warning message not specified",
+        "2: warning message not specified",
+        "3: warning message not specified",
+        "4: the least squares problems with coefficient matrix "
+            "U_f,  used for computing the weighted oblique "
+            "projection (for METH = 'N'), have a rank-deficient "
+            "coefficient matrix",
+        "5: the least squares problem with coefficient matrix "
+            "r_1  [6], used for computing the weighted oblique "
+            "projection (for METH = 'N'), has a rank-deficient "
+            "coefficient matrix"};
+
+    error_msg ("ident: IB01ND", info, 2, err_msg);
+    warning_msg ("ident: IB01ND", iwarn, 5, warn_msg);
+
+    // SLICOT routine IB01OD - order estimate
+    n = 0;
+    iwarn = 0;
+    info = 0;
+
+    CONTROL_XFCN (ib01od, IB01OD, (nobr, 0, l, 0), (info, iwarn),
+                 (ctrl,
+                  nobr, l,
+                  sv.fortran_vec (),
+                  n,
+                  tol,
+                  iwarn, info));
+
+    if (f77_exception_encountered)
+        error ("ident: exception in SLICOT subroutine IB01OD");
+
+    static const char* warn_msg_o[] = {
+        "0: OK",
+        "1: warning message not specified",
+        "2: warning message not specified",
+        "3: all singular values were exactly zero, hence  N = 0 "
+            "(both input and output were identically zero)"};
+
+    warning_msg ("ident: IB01OD", iwarn, 3, warn_msg_o);
+
+    if (info != 0)
+        error ("ident: IB01OD returned info = %d", static_cast<int> (info));
+}
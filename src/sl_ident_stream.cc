@@ -0,0 +1,527 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Out-of-core data compression for subspace identification.
+The input-output data are fed to IB01AD in sequential batches
+(BATCH = 'F', 'I', ..., 'L', CONCT = 'C'), such that only one chunk
+of data and the 2*(m+l)*nobr square triangular factor R are held in
+memory.  The data come either chunk by chunk from the caller, or
+from a memory-mapped binary file which is processed in one call.
+Uses SLICOT IB01AD by courtesy of NICONET e.V.
+<http://www.slicot.org>
+
+Created: October 2026
+Version: 0.3
+
+*/
+
+#include <octave/oct.h>
+#include <octave/oct-map.h>
+#include "common.h"
+#include <cstdio>
+#include <algorithm>
+#include <vector>
+
+extern "C"
+{
+    int F77_FUNC (ib01ad, IB01AD)
+                 (char& METH, char& ALG, char& JOBD,
+                  char& BATCH, char& CONCT, char& CTRL,
+                  F77_INT& NOBR, F77_INT& M, F77_INT& L,
+                  F77_INT& NSMP,
+                  double* U, F77_INT& LDU,
+                  double* Y, F77_INT& LDY,
+                  F77_INT& N,
+                  double* R, F77_INT& LDR,
+                  double* SV,
+                  double& RCOND, double& TOL,
+                  F77_INT* IWORK,
+                  double* DWORK, F77_INT& LDWORK,
+                  F77_INT& IWARN, F77_INT& INFO);
+}
+
+// minimal IB01AD workspace, see the documentation of LDWORK in IB01AD.f
+static F77_INT
+ident_stream_ldwork (char meth, char alg, char jobd, char batch, char conct,
+                     F77_INT nobr, F77_INT m, F77_INT l,
+                     F77_INT ldr, F77_INT ns)
+{
+    F77_INT ldwork;
+
+    if (alg == 'C')
+    {
+        if (batch == 'F' || batch == 'I')
+        {
+            if (conct == 'C')
+                ldwork = (4*nobr-2)*(m+l);
+            else
+                ldwork = 1;
+        }
+        else if (meth == 'M')
+        {
+            if (conct == 'C' && batch == 'L')
+                ldwork = max ((4*nobr-2)*(m+l), 5*l*nobr);
+            else if (jobd == 'M')
+                ldwork = max ((2*m-1)*nobr, (m+l)*nobr, 5*l*nobr);
+            else
+                ldwork = 5*l*nobr;
+        }
+        else
+            ldwork = 5*(m+l)*nobr + 1;
+    }
+    else if (alg == 'F')
+    {
+        if (batch != 'O' && conct == 'C')
+            ldwork = (m+l)*2*nobr*(m+l+3);
+        else if (batch == 'F' || batch == 'I')
+            ldwork = (m+l)*2*nobr*(m+l+1);
+        else
+            ldwork = (m+l)*4*nobr*(m+l+1)+(m+l)*2*nobr;
+    }
+    else    // alg == 'Q'
+    {
+        if (ldr >= ns && batch == 'F')
+            ldwork = 4*(m+l)*nobr;
+        else if (ldr >= ns && batch == 'O')
+        {
+            if (meth == 'M')
+                ldwork = max (4*(m+l)*nobr, 5*l*nobr);
+            else
+                ldwork = 5*(m+l)*nobr + 1;
+        }
+        else if (conct == 'C' && (batch == 'I' || batch == 'L'))
+            ldwork = 4*(nobr+1)*(m+l)*nobr;
+        else
+            ldwork = 6*(m+l)*nobr;
+    }
+
+    return max (1, ldwork);
+}
+
+// feed one batch of nsmp samples to IB01AD, the state is kept in st
+static void
+ident_stream_batch (octave_scalar_map& st,
+                    const double* u, F77_INT ldu,
+                    const double* y, F77_INT ldy,
+                    F77_INT nsmp, bool last)
+{
+    F77_INT nobr = st.getfield ("nobr").int_value ();
+    F77_INT m = st.getfield ("m").int_value ();
+    F77_INT l = st.getfield ("l").int_value ();
+    F77_INT imeth = st.getfield ("meth").int_value ();
+    F77_INT ialg = st.getfield ("alg").int_value ();
+    F77_INT ictrl = st.getfield ("ctrl").int_value ();
+    double rcond = st.getfield ("rcond").double_value ();
+    double tol = st.getfield ("tol").double_value ();
+    F77_INT nbatch = st.getfield ("nbatch").int_value ();
+    F77_INT nsmpl = st.getfield ("nsmpl").int_value ();
+
+    // memory budget in bytes for the optional workspace, 0: no limit
+    double budget = st.isfield ("budget") ? st.getfield ("budget").double_value () : 0.0;
+
+    char meth = (imeth == 0) ? 'M' : 'N';
+    char jobd = meth;           // not relevant for METH = 'N'
+    char alg = (ialg == 0) ? 'C' : ((ialg == 1) ? 'F' : 'Q');
+    char conct = 'C';           // consecutive chunks of one record
+    char ctrl = (ictrl == 0) ? 'C' : 'N';
+    char batch;
+
+    if (nbatch == 0 && last)
+        batch = 'O';
+    else if (nbatch == 0)
+        batch = 'F';
+    else if (last)
+        batch = 'L';
+    else
+        batch = 'I';
+
+    // IB01AD keeps part of the state in SAVEd local variables, hence only
+    // one data stream at a time, see control_ib01ad_begin
+    if (nbatch == 0)
+        st.assign ("id", octave_value (control_ib01ad_begin ()));
+    else if (! control_ib01ad_owner (st.getfield ("id").int_value ()))
+        error ("ident: the data stream was interrupted by another use of IB01AD");
+
+    if (batch == 'O')
+    {
+        if (nsmp < 2*(m+l+1)*nobr - 1)
+            error ("__sl_ident_stream__: require NSMP >= 2*(M+L+1)*NOBR - 1");
+    }
+    else if (nsmp < 2*nobr)
+        error ("__sl_ident_stream__: require NSMP >= 2*NOBR for every chunk");
+
+    if (last && nsmpl + nsmp < 2*(m+l+1)*nobr - 1)
+        error ("__sl_ident_stream__: require at least 2*(M+L+1)*NOBR - 1 samples in total");
+
+    F77_INT nr = 2*(m+l)*nobr;
+    F77_INT ldr;
+
+    if (meth == 'M' && jobd == 'M')
+        ldr = max (nr, 3*m*nobr);
+    else
+        ldr = nr;
+
+    F77_INT liwork;
+
+    if (meth == 'N')
+        liwork = (m+l)*nobr;
+    else if (alg == 'F')
+        liwork = m+l;
+    else
+        liwork = 0;
+
+    // state carried between the batches:  R, the integer workspace and the
+    // leading part of DWORK which holds the data of the previous chunk
+    F77_INT ns = nsmp - 2*nobr + 1;
+    F77_INT nstate = ident_stream_ldwork (meth, alg, jobd, 'I', conct,
+                                          nobr, m, l, ldr, ns);
+
+    Matrix r;
+    ColumnVector state;
+    ColumnVector istate;
+
+    if (nbatch == 0)
+    {
+        r = Matrix (ldr, nr, 0.0);
+        state = ColumnVector (nstate, 0.0);
+        istate = ColumnVector (max (1, liwork), 0.0);
+    }
+    else
+    {
+        r = st.getfield ("r").matrix_value ();
+        state = st.getfield ("dwork").column_vector_value ();
+        istate = st.getfield ("iwork").column_vector_value ();
+    }
+
+    // workspace, see the comments in sl_ident.cc on the optimal size
+    F77_INT ldwork = control_workspace (max (ident_stream_ldwork (meth, alg, jobd, batch, conct,
+                                                                  nobr, m, l, ldr, ns),
+                                             nstate),
+                                        (ns+2.0)*nr, budget);
+
+    CONTROL_WORK_BUFFER (double, dwork, ldwork);
+    CONTROL_WORK_BUFFER (F77_INT, iwork, max (1, liwork));
+
+    std::copy (state.data (), state.data () + nstate, dwork);
+
+    for (F77_INT i = 0; i < max (1, liwork); i++)
+        iwork[i] = static_cast<F77_INT> (istate(i));
+
+    ColumnVector sv (l*nobr);
+    F77_INT n = 0;
+
+    // error indicators
+    F77_INT iwarn = 0;
+    F77_INT info = 0;
+
+    // IB01AD does not write to U and Y
+    CONTROL_XFCN (ib01ad, IB01AD, (nobr, m, l, ldwork), (info, iwarn),
+                 (meth, alg, jobd,
+                  batch, conct, ctrl,
+                  nobr, m, l,
+                  nsmp,
+                  const_cast<double*> (u), ldu,
+                  const_cast<double*> (y), ldy,
+                  n,
+                  r.fortran_vec (), ldr,
+                  sv.fortran_vec (),
+                  rcond, tol,
+                  iwork,
+                  dwork, ldwork,
+                  iwarn, info));
+
+    if (f77_exception_encountered)
+        error ("ident: exception in SLICOT subroutine IB01AD");
+
+    static const char* err_msg[] = {
+        "0: OK",
+        "1: a fast algorithm was requested (ALG = 'C', or 'F') "
+            "in sequential data processing, but it failed; the "
+            "routine can be repeatedly called again using the "
+            "standard QR algorithm",
+        "2: the singular value decomposition (SVD) algorithm did "
+            "not converge"};
+
+    static const char* warn_msg[] = {
+        "0: OK",
+        "1: the number of 100 cycles in sequential data "
+            "processing has been exhausted without signaling "
+            "that the last block of data was get; the cycle "
+            "counter was reinitialized",
+        "2: a fast algorithm was requested (ALG = 'C' or 'F'), "
+            "but it failed, and the QR algorithm was then used "
+            "(non-sequential data processing)",
+        "3: all singular values were exactly zero, hence  N = 0 "
+            "(both input and output were identically zero)",
+        "4: the least squares problems with coefficient matrix "
+            "U_f,  used for computing the weighted oblique "
+            "projection (for METH = 'N'), have a rank-deficient "
+            "coefficient matrix",
+        "5: the least squares problem with coefficient matrix "
+            "r_1  [6], used for computing the weighted oblique "
+            "projection (for METH = 'N'), has a rank-deficient "
+            "coefficient matrix"};
+
+    error_msg ("ident: IB01AD", info, 2, err_msg);
+
+    // long records pass more than 100 batches by design
+    if (iwarn != 1)
+        warning_msg ("ident: IB01AD", iwarn, 5, warn_msg);
+
+    for (F77_INT i = 0; i < nstate; i++)
+        state(i) = dwork[i];
+
+    for (F77_INT i = 0; i < max (1, liwork); i++)
+        istate(i) = static_cast<double> (iwork[i]);
+
+    st.assign ("r", r);
+    st.assign ("dwork", state);
+    st.assign ("iwork", istate);
+    st.assign ("nbatch", octave_value (nbatch + 1));
+    st.assign ("nsmpl", octave_value (nsmpl + nsmp));
+    st.assign ("done", octave_value (last));
+
+    if (last)
+    {
+        control_ib01ad_end (st.getfield ("id").int_value ());
+        st.assign ("sv", sv);
+        st.assign ("n", octave_value (n));
+    }
+}
+
+// columns j0, ..., j1-1 of a chunk of float32 data, converted to float64
+static void
+ident_stream_single (const float* data, F77_INT nsmp, F77_INT k0, F77_INT nk,
+                     F77_INT j0, F77_INT j1, double* col)
+{
+    for (F77_INT j = j0; j < j1; j++)
+    {
+        const float* src = data + static_cast<octave_idx_type> (j) * nsmp + k0;
+        std::copy (src, src + nk, col + static_cast<octave_idx_type> (j - j0) * nk);
+    }
+}
+
+// process a whole file of column-major float64 (or float32) data, the
+// columns of Y followed by the columns of U, each of length nsmp
+static void
+ident_stream_file (octave_scalar_map& st, const std::string& file,
+                   double offset, F77_INT nsmp, F77_INT chunk, bool single)
+{
+    F77_INT nobr = st.getfield ("nobr").int_value ();
+    F77_INT m = st.getfield ("m").int_value ();
+    F77_INT l = st.getfield ("l").int_value ();
+
+    if (chunk < 2*nobr)
+        chunk = 2*nobr;
+
+    // chunk boundaries, a short remainder is merged into the last chunk
+    F77_INT nchunk = max (1, nsmp / chunk);
+
+    octave_idx_type nval = static_cast<octave_idx_type> (nsmp) * (l+m);
+    size_t bytes = single ? sizeof (float) : sizeof (double);
+
+    if (static_cast<octave_idx_type> (offset) % bytes != 0)
+        error ("ident: data offset must be a multiple of %d bytes",
+               static_cast<int> (bytes));
+
+#if ! defined (_WIN32)
+
+    // read-only private mapping, pages are loaded on demand and can be
+    // dropped by the kernel, hence the resident memory stays bounded
+    control_mapped_file map (file, offset, static_cast<double> (nval) * bytes, true);
+
+    const char* data = map.data ();
+
+    for (F77_INT i = 0; i < nchunk; i++)
+    {
+        octave_quit ();
+
+        F77_INT k0 = i * chunk;
+        F77_INT nk = (i == nchunk-1) ? nsmp - k0 : chunk;
+
+        if (single)
+        {
+            const float* fdata = reinterpret_cast<const float*> (data);
+
+            Matrix y (nk, l);
+            Matrix u (max (1, nk), m);
+
+            ident_stream_single (fdata, nsmp, k0, nk, 0, l, y.fortran_vec ());
+            ident_stream_single (fdata, nsmp, k0, nk, l, l+m, u.fortran_vec ());
+
+            F77_INT ldu = (m == 0) ? 1 : nk;
+
+            ident_stream_batch (st, u.data (), ldu, y.data (), nk,
+                                nk, i == nchunk-1);
+        }
+        else
+        {
+            const double* ddata = reinterpret_cast<const double*> (data);
+
+            F77_INT ldy = nsmp;
+            F77_INT ldu = (m == 0) ? 1 : nsmp;
+
+            ident_stream_batch (st,
+                                ddata + static_cast<octave_idx_type> (l) * nsmp + k0, ldu,
+                                ddata + k0, ldy,
+                                nk, i == nchunk-1);
+        }
+    }
+
+#else
+
+    // no memory mapping, read one chunk at a time
+
+    FILE* fid = std::fopen (file.c_str (), "rb");
+
+    if (! fid)
+        error ("ident: cannot open data file '%s'", file.c_str ());
+
+    try
+    {
+        for (F77_INT i = 0; i < nchunk; i++)
+        {
+            octave_quit ();
+
+            F77_INT k0 = i * chunk;
+            F77_INT nk = (i == nchunk-1) ? nsmp - k0 : chunk;
+
+            Matrix y (nk, l);
+            Matrix u (max (1, nk), m);
+            std::vector<float> tmp (single ? nk : 0);
+
+            for (F77_INT j = 0; j < l+m; j++)
+            {
+                double* col = (j < l) ? y.fortran_vec () + j*nk
+                                      : u.fortran_vec () + (j-l)*nk;
+
+                __int64 pos = static_cast<__int64> (offset)
+                              + (static_cast<__int64> (j) * nsmp + k0) * bytes;
+
+                bool ok = _fseeki64 (fid, pos, SEEK_SET) == 0;
+
+                if (single)
+                {
+                    ok = ok && std::fread (tmp.data (), sizeof (float), nk, fid) == static_cast<size_t> (nk);
+                    std::copy (tmp.begin (), tmp.end (), col);
+                }
+                else
+                    ok = ok && std::fread (col, sizeof (double), nk, fid) == static_cast<size_t> (nk);
+
+                if (! ok)
+                    error ("ident: data file '%s' is too short", file.c_str ());
+            }
+
+            F77_INT ldu = (m == 0) ? 1 : nk;
+
+            ident_stream_batch (st, u.data (), ldu, y.data (), nk,
+                                nk, i == nchunk-1);
+        }
+    }
+    catch (...)
+    {
+        std::fclose (fid);
+        throw;
+    }
+
+    std::fclose (fid);
+
+#endif
+}
+
+// PKG_ADD: autoload ("__sl_ident_stream__", "__control_slicot_ident__.oct");
+DEFUN_DLD (__sl_ident_stream__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot IB01AD Release 5.0, sequential data processing\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin != 2 && nargin != 4)
+    {
+        print_usage ();
+    }
+    else
+    {
+        // st:  nobr, meth, alg, ctrl, rcond, tol  on the first call,
+        // afterwards the state of the stream
+        octave_scalar_map st = args(0).scalar_map_value ();
+
+        if (! st.isfield ("nbatch"))
+        {
+            st.assign ("nbatch", octave_value (0));
+            st.assign ("nsmpl", octave_value (0));
+        }
+        else if (st.getfield ("done").bool_value ())
+            error ("ident: the data stream has already been closed");
+
+        if (nargin == 4)
+        {
+            // one chunk  __sl_ident_stream__ (st, y, u, last)
+            Matrix y = args(1).matrix_value ();
+            Matrix u = args(2).matrix_value ();
+            bool last = args(3).bool_value ();
+
+            F77_INT nsmp = TO_F77_INT (y.rows ());
+            F77_INT l = TO_F77_INT (y.columns ());
+            F77_INT m = TO_F77_INT (u.columns ());
+
+            if (st.getfield ("nbatch").int_value () == 0)
+            {
+                st.assign ("l", octave_value (l));
+                st.assign ("m", octave_value (m));
+            }
+            else if (l != st.getfield ("l").int_value ()
+                     || m != st.getfield ("m").int_value ())
+                error ("ident: the number of channels of the data stream changed");
+
+            if (m > 0 && u.rows () != nsmp)
+                error ("ident: the chunks of inputs and outputs differ in length");
+
+            F77_INT ldu = (m == 0) ? 1 : nsmp;
+
+            ident_stream_batch (st, u.data (), ldu, y.data (), nsmp,
+                                nsmp, last);
+        }
+        else
+        {
+            // memory-mapped file  __sl_ident_stream__ (st, src)
+            octave_scalar_map src = args(1).scalar_map_value ();
+
+            std::string file = src.getfield ("file").string_value ();
+            double offset = src.getfield ("offset").double_value ();
+            F77_INT nsmp = src.getfield ("nsmp").int_value ();
+            F77_INT chunk = src.getfield ("chunk").int_value ();
+            bool single = src.isfield ("precision")
+                          && src.getfield ("precision").string_value () == "single";
+
+            st.assign ("l", src.getfield ("outputs"));
+            st.assign ("m", src.getfield ("inputs"));
+
+            ident_stream_file (st, file, offset, nsmp, chunk, single);
+        }
+
+        // return values
+        retval(0) = st;
+    }
+
+    return retval;
+}
@@ -0,0 +1,230 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Parallel data compression for multi-experiment subspace identification.
+The triangular factor R of the concatenated block Hankel matrices
+
+    H = [ H_1; H_2; ...; H_e ],   H_i = [ U_i  Y_i ]
+
+is computed by a tall-skinny QR (TSQR):  every experiment is reduced
+to its own factor R_i by blocked DGEQRF in a separate thread, and the
+R_i are combined pairwise in a binary reduction tree.  R is passed to
+ident_factor_svd, see sl_ident_factor.cc.  The result can be used by
+IB01BD exactly like the factor returned by IB01AD.
+
+Created: October 2026
+Version: 0.3
+
+*/
+
+#include <octave/oct.h>
+#include <octave/Cell.h>
+#include "common.h"
+#include <vector>
+#include <algorithm>
+
+// R factor of the block Hankel matrix of one experiment, nr = 2*(m+l)*nobr.
+// The rows are processed in blocks of nb rows below the current factor.
+static F77_INT
+tsqr_experiment (const Matrix& y, const Matrix& u,
+                 F77_INT nobr, F77_INT m, F77_INT l,
+                 F77_INT nb, double* r)
+{
+    F77_INT nsmp = TO_F77_INT (y.rows ());
+    F77_INT ns = nsmp - 2*nobr + 1;
+    F77_INT nr = 2*(m+l)*nobr;
+    F77_INT mu = 2*m*nobr;              // columns of U
+    F77_INT ldw = nr + nb;
+
+    std::vector<double> w (static_cast<size_t> (ldw) * nr);
+    F77_INT nrows = 0;                  // rows of the current factor
+
+    const double* py = y.data ();
+    const double* pu = u.data ();
+
+    for (F77_INT k0 = 0; k0 < ns; k0 += nb)
+    {
+        F77_INT nk = min (nb, ns - k0);
+
+        // current factor on top
+        for (F77_INT j = 0; j < nr; j++)
+            for (F77_INT i = 0; i < nrows; i++)
+                w[i + j*ldw] = r[i + j*nr];
+
+        // block Hankel rows  [u(k)' ... u(k+2s-1)'  y(k)' ... y(k+2s-1)']
+        for (F77_INT jb = 0; jb < 2*nobr; jb++)
+        {
+            for (F77_INT c = 0; c < m; c++)
+            {
+                double* col = w.data () + (jb*m + c)*ldw + nrows;
+                const double* src = pu + c*nsmp + k0 + jb;
+                std::copy (src, src + nk, col);
+            }
+
+            for (F77_INT c = 0; c < l; c++)
+            {
+                double* col = w.data () + (mu + jb*l + c)*ldw + nrows;
+                const double* src = py + c*nsmp + k0 + jb;
+                std::copy (src, src + nk, col);
+            }
+        }
+
+        F77_INT info = ident_factor_qr (w.data (), ldw, nrows + nk, nr, r, true);
+
+        if (info != 0)
+            return info;
+
+        nrows = min (nr, nrows + nk);
+    }
+
+    return 0;
+}
+
+// PKG_ADD: autoload ("__sl_ident_tsqr__", "__control_slicot_ident__.oct");
+DEFUN_DLD (__sl_ident_tsqr__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot IB01ND and IB01OD Release 5.0, parallel TSQR data compression\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin != 9)
+    {
+        print_usage ();
+    }
+    else
+    {
+        // arguments in
+        char meth;
+        char ctrl;
+
+        const Cell y_cell = args(0).cell_value ();
+        const Cell u_cell = args(1).cell_value ();
+        F77_INT nobr = args(2).int_value ();
+        const F77_INT imeth = args(3).int_value ();
+        const F77_INT ictrl = args(4).int_value ();
+        double rcond = args(5).double_value ();
+        double tol = args(6).double_value ();
+        int nthreads = args(7).int_value ();
+        F77_INT nb = args(8).int_value ();      // rows per block
+
+        if (imeth == 0)
+            meth = 'M';
+        else
+            meth = 'N';                         // also for combined method
+
+        if (ictrl == 0)
+            ctrl = 'C';
+        else
+            ctrl = 'N';
+
+        F77_INT n_exp = TO_F77_INT (y_cell.numel ());
+        F77_INT m = TO_F77_INT (u_cell.elem(0).columns ());
+        F77_INT l = TO_F77_INT (y_cell.elem(0).columns ());
+        F77_INT nr = 2*(m+l)*nobr;
+
+        nb = max (nb, nr);
+
+        // extract the data in the interpreter thread
+        std::vector<Matrix> y (n_exp);
+        std::vector<Matrix> u (n_exp);
+
+        F77_INT nsmpl = 0;                      // total number of samples
+        F77_INT nsl = 0;                        // total number of Hankel rows
+
+        for (F77_INT i = 0; i < n_exp; i++)
+        {
+            y[i] = y_cell.elem(i).matrix_value ();
+            u[i] = u_cell.elem(i).matrix_value ();
+
+            F77_INT nsmp = TO_F77_INT (y[i].rows ());
+
+            if (nsmp < 2*nobr)
+                error ("__sl_ident_tsqr__: require NSMP >= 2*NOBR");
+
+            nsmpl += nsmp;
+            nsl += nsmp - 2*nobr + 1;
+        }
+
+        if (nsmpl < 2*(m+l+1)*nobr - 1)
+            error ("__sl_ident_tsqr__: require NSMP >= 2*(M+L+1)*NOBR - 1");
+
+        // R factors of the experiments, one nr-by-nr block each
+        std::vector<double> rf (static_cast<size_t> (nr) * nr * n_exp, 0.0);
+        std::vector<F77_INT> info_f (n_exp, 0);
+
+        parallel_for (n_exp, nthreads, [&] (octave_idx_type i)
+        {
+            info_f[i] = tsqr_experiment (y[i], u[i], nobr, m, l, nb,
+                                         rf.data () + static_cast<size_t> (i) * nr * nr);
+        });
+
+        // binary reduction tree, R_i = qr ([R_i; R_(i+step)])
+        for (F77_INT step = 1; step < n_exp; step *= 2)
+        {
+            octave_quit ();
+
+            F77_INT npair = (n_exp + 2*step - 1) / (2*step);
+
+            parallel_for (npair, nthreads, [&] (octave_idx_type k)
+            {
+                F77_INT i = k * 2 * step;
+                F77_INT j = i + step;
+
+                if (j >= n_exp || info_f[i] != 0)
+                    return;
+
+                F77_INT ldw = 2*nr;
+                std::vector<double> w (static_cast<size_t> (ldw) * nr);
+                double* ri = rf.data () + static_cast<size_t> (i) * nr * nr;
+                double* rj = rf.data () + static_cast<size_t> (j) * nr * nr;
+
+                for (F77_INT c = 0; c < nr; c++)
+                {
+                    std::copy (ri + c*nr, ri + (c+1)*nr, w.data () + c*ldw);
+                    std::copy (rj + c*nr, rj + (c+1)*nr, w.data () + c*ldw + nr);
+                }
+
+                info_f[i] = ident_factor_qr (w.data (), ldw, ldw, nr, ri, true);
+            });
+        }
+
+        for (F77_INT i = 0; i < n_exp; i++)
+            if (info_f[i] != 0)
+                error ("__sl_ident_tsqr__: DGEQRF returned info = %d",
+                       static_cast<int> (info_f[i]));
+
+        // SVD and order estimate
+        Matrix r;
+        ColumnVector sv;
+        F77_INT n;
+
+        ident_factor_svd (rf.data (), nsl, meth, ctrl, nobr, m, l, rcond, tol, r, sv, n);
+
+        // return values
+        retval(0) = r;
+        retval(1) = sv;
+        retval(2) = octave_value (n);
+        retval(3) = octave_value (nsmpl);
+    }
+
+    return retval;
+}
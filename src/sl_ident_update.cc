@@ -0,0 +1,264 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Recursive and sliding-window data compression for subspace identification.
+The raw triangular factor R0 of the block Hankel matrix
+
+    H = [ U  Y ],   R0' R0 = H' H
+
+is kept between the calls.  New rows of H are added by a blocked
+Householder QR of [R0; H_new] (DGEQRF), old rows of a sliding window are
+removed one by one by Givens rotations (LINPACK DCHDD downdating).  If a
+downdate fails because R0' R0 - h' h is not numerically positive definite,
+R0 is computed again from the samples of the window.
+R0 is passed to ident_factor_svd, see sl_ident_factor.cc, such that the
+result can be used by IB01BD.
+
+Created: October 2026
+Version: 0.3
+
+*/
+
+#include <octave/oct.h>
+#include "common.h"
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+// row k of the block Hankel matrix of the samples y, u,
+// [u(k)' ... u(k+2s-1)'  y(k)' ... y(k+2s-1)'], stored with stride inc
+static void
+ident_update_row (const Matrix& y, const Matrix& u, F77_INT nobr,
+                  F77_INT k, double* h, F77_INT inc)
+{
+    F77_INT m = TO_F77_INT (u.columns ());
+    F77_INT l = TO_F77_INT (y.columns ());
+    F77_INT mu = 2*m*nobr;
+
+    for (F77_INT jb = 0; jb < 2*nobr; jb++)
+    {
+        for (F77_INT c = 0; c < m; c++)
+            h[(jb*m + c)*inc] = u(k + jb, c);
+
+        for (F77_INT c = 0; c < l; c++)
+            h[(mu + jb*l + c)*inc] = y(k + jb, c);
+    }
+}
+
+// add all Hankel rows of y, u to the nr-by-nr factor r0,
+// blocks of nb rows below r0 are factored by ident_factor_qr
+static void
+ident_update_add (Matrix& r0, const Matrix& y, const Matrix& u,
+                  F77_INT nobr, F77_INT nb)
+{
+    F77_INT nr = TO_F77_INT (r0.rows ());
+    F77_INT ns = TO_F77_INT (y.rows ()) - 2*nobr + 1;
+    F77_INT ldw = nr + nb;
+
+    std::vector<double> w (static_cast<size_t> (ldw) * nr);
+    double* pr = r0.fortran_vec ();
+
+    for (F77_INT k0 = 0; k0 < ns; k0 += nb)
+    {
+        octave_quit ();
+
+        F77_INT nk = min (nb, ns - k0);
+        F77_INT mrows = nr + nk;
+
+        for (F77_INT j = 0; j < nr; j++)
+            std::copy (pr + j*nr, pr + (j+1)*nr, w.data () + j*ldw);
+
+        for (F77_INT i = 0; i < nk; i++)
+            ident_update_row (y, u, nobr, k0 + i, w.data () + nr + i, ldw);
+
+        F77_INT info = ident_factor_qr (w.data (), ldw, mrows, nr, pr, false);
+
+        if (f77_exception_encountered)
+            error ("ident: exception in LAPACK subroutine DGEQRF");
+
+        if (info != 0)
+            error ("ident: DGEQRF returned info = %d", static_cast<int> (info));
+    }
+}
+
+// remove the row h from the upper triangular factor r (r'r - h'h),
+// LINPACK DCHDD.  Returns false if the result is not positive definite.
+static bool
+ident_update_downdate (double* r, F77_INT nr, std::vector<double>& h)
+{
+    std::vector<double> c (nr);
+    std::vector<double> s (nr);
+
+    // solve r' a = h, a overwrites h
+    for (F77_INT i = 0; i < nr; i++)
+    {
+        double sum = h[i];
+
+        for (F77_INT k = 0; k < i; k++)
+            sum -= r[k + i*nr] * h[k];
+
+        if (r[i + i*nr] == 0.0)
+            return false;
+
+        h[i] = sum / r[i + i*nr];
+    }
+
+    double norm = 0.0;
+
+    for (F77_INT i = 0; i < nr; i++)
+        norm += h[i] * h[i];
+
+    if (norm >= 1.0)
+        return false;
+
+    double alpha = std::sqrt (1.0 - norm);
+
+    // rotations which eliminate a
+    for (F77_INT i = nr-1; i >= 0; i--)
+    {
+        double scale = alpha + std::abs (h[i]);
+        double a = alpha / scale;
+        double b = h[i] / scale;
+        double nrm = std::sqrt (a*a + b*b);
+
+        c[i] = a / nrm;
+        s[i] = b / nrm;
+        alpha = scale * nrm;
+    }
+
+    // apply the rotations to r
+    for (F77_INT j = 0; j < nr; j++)
+    {
+        double xx = 0.0;
+
+        for (F77_INT i = j; i >= 0; i--)
+        {
+            double t = c[i]*xx + s[i]*r[i + j*nr];
+            r[i + j*nr] = c[i]*r[i + j*nr] - s[i]*xx;
+            xx = t;
+        }
+    }
+
+    return true;
+}
+
+// PKG_ADD: autoload ("__sl_ident_update__", "__control_slicot_ident__.oct");
+DEFUN_DLD (__sl_ident_update__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot IB01ND and IB01OD Release 5.0, recursive data compression\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin != 13)
+    {
+        print_usage ();
+    }
+    else
+    {
+        // arguments in
+        char meth;
+        char ctrl;
+
+        Matrix r0 = args(0).matrix_value ();        // raw factor, empty at start
+        const Matrix y_add = args(1).matrix_value ();
+        const Matrix u_add = args(2).matrix_value ();
+        const Matrix y_del = args(3).matrix_value ();
+        const Matrix u_del = args(4).matrix_value ();
+        const Matrix y_win = args(5).matrix_value ();   // samples for a new factor
+        const Matrix u_win = args(6).matrix_value ();
+        F77_INT nsmpl = args(7).int_value ();           // samples represented by R0
+        F77_INT nobr = args(8).int_value ();
+        const F77_INT imeth = args(9).int_value ();
+        const F77_INT ictrl = args(10).int_value ();
+        double rcond = args(11).double_value ();
+        double tol = args(12).double_value ();
+
+        if (imeth == 0)
+            meth = 'M';
+        else
+            meth = 'N';                         // also for combined method
+
+        if (ictrl == 0)
+            ctrl = 'C';
+        else
+            ctrl = 'N';
+
+        F77_INT m = TO_F77_INT (u_win.columns ());
+        F77_INT l = TO_F77_INT (y_win.columns ());
+        F77_INT nr = 2*(m+l)*nobr;
+        F77_INT nsl = nsmpl - 2*nobr + 1;       // Hankel rows in R0
+        F77_INT nb = max (nr, 256);             // rows per block
+
+        if (nsmpl < 2*(m+l+1)*nobr - 1)
+            error ("__sl_ident_update__: require NSMP >= 2*(M+L+1)*NOBR - 1 in the window");
+
+        bool rebuild = r0.isempty ();
+
+        if (rebuild)
+            r0 = Matrix (nr, nr, 0.0);
+        else
+        {
+            // new rows first, then remove the old ones
+            if (y_add.rows () >= 2*nobr)
+                ident_update_add (r0, y_add, u_add, nobr, nb);
+
+            F77_INT nd = TO_F77_INT (y_del.rows ()) - 2*nobr + 1;
+            std::vector<double> h (nr);
+
+            for (F77_INT k = 0; k < nd && ! rebuild; k++)
+            {
+                ident_update_row (y_del, u_del, nobr, k, h.data (), 1);
+                rebuild = ! ident_update_downdate (r0.fortran_vec (), nr, h);
+            }
+
+            if (rebuild)
+            {
+                warning ("ident: downdating the factor failed, it is computed again from the window");
+                r0 = Matrix (nr, nr, 0.0);
+            }
+        }
+
+        if (rebuild)
+        {
+            if (y_win.rows () < 2*nobr)
+                error ("__sl_ident_update__: no samples to compute the factor");
+
+            ident_update_add (r0, y_win, u_win, nobr, nb);
+        }
+
+        // SVD and order estimate
+        Matrix r;
+        ColumnVector sv;
+        F77_INT n;
+
+        ident_factor_svd (r0.data (), nsl, meth, ctrl, nobr, m, l, rcond, tol, r, sv, n);
+
+        // return values
+        retval(0) = r0;
+        retval(1) = r;
+        retval(2) = sv;
+        retval(3) = octave_value (n);
+        retval(4) = octave_value (nsmpl);
+    }
+
+    return retval;
+}
@@ -23,7 +23,7 @@ Uses SLICOT MB05ND by courtesy of NICONET e.V.
 
 Author: Thomas Vasileiou <thomas-v@wildmail.com>
 Created: March 2014
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -43,7 +43,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_mb05nd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_mb05nd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_mb05nd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot MB05ND Release 5.0\n\
@@ -84,23 +84,23 @@ For internal use only.")
         
         // workspace
         F77_INT ldwork = max (1, 2*n*n);                 // optimum performance
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, n);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, n);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info = 0;
 
 
         // SLICOT routine MB05ND
-        F77_XFCN (mb05nd, MB05ND,
-                 (n, delta,
-                  a.fortran_vec (), lda,
-                  ex.fortran_vec (), ldex,
-                  exint.fortran_vec (), ldexin,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (mb05nd, MB05ND, (n, 0, 0, ldwork), (info),
+                     (n, delta,
+                      a.fortran_vec (), lda,
+                      ex.fortran_vec (), ldex,
+                      exint.fortran_vec (), ldexin,
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("__sl_mb05nd__: exception in SLICOT subroutine MB05ND");
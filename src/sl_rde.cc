@@ -0,0 +1,428 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Finite-horizon solution of discrete-time Riccati difference equations.
+Square-root (array) algorithm based on LAPACK DGEQRF:  the factor of
+P(k) is propagated by one QR factorization per time step
+
+    [ Ur       0     ]       [ X   Y ]
+    [ U*B      U*Abar]  = Q  [ 0   Z ] ,   P(k+1) = U'U,  P(k) = Z'Z
+    [ 0        Fq    ]       [ 0   0 ]
+
+with R = Ur'Ur, Abar = A - B*inv(R)*S', Qbar = Q - S*inv(R)*S' = Fq'Fq
+and gain K(k) = inv(X)*Y + inv(R)*S'.  The filter (forward) recursion
+is obtained by duality, i.e. A -> A', B -> C'.
+
+Created: October 2026
+Version: 0.3
+
+*/
+
+#include <octave/oct.h>
+#include "common.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+extern "C"
+{
+    int F77_FUNC (dgemm, DGEMM)
+                 (char& TRANSA, char& TRANSB,
+                  F77_INT& M, F77_INT& N, F77_INT& K,
+                  double& ALPHA,
+                  const double* A, F77_INT& LDA,
+                  const double* B, F77_INT& LDB,
+                  double& BETA,
+                  double* C, F77_INT& LDC);
+
+    int F77_FUNC (dtrsm, DTRSM)
+                 (char& SIDE, char& UPLO,
+                  char& TRANSA, char& DIAG,
+                  F77_INT& M, F77_INT& N,
+                  double& ALPHA,
+                  const double* A, F77_INT& LDA,
+                  double* B, F77_INT& LDB);
+
+    int F77_FUNC (dgeqrf, DGEQRF)
+                 (F77_INT& M, F77_INT& N,
+                  double* A, F77_INT& LDA,
+                  double* TAU,
+                  double* WORK, F77_INT& LWORK,
+                  F77_INT& INFO);
+
+    int F77_FUNC (dpotrf, DPOTRF)
+                 (char& UPLO, F77_INT& N,
+                  double* A, F77_INT& LDA,
+                  F77_INT& INFO);
+
+    int F77_FUNC (dsyev, DSYEV)
+                 (char& JOBZ, char& UPLO,
+                  F77_INT& N,
+                  double* A, F77_INT& LDA,
+                  double* W,
+                  double* WORK, F77_INT& LWORK,
+                  F77_INT& INFO);
+}
+
+// copy page k of x (rows-by-cols, or cols-by-rows if trans) into dst,
+// pages are only advanced if x is time-varying (3-D)
+static void
+rde_page (const NDArray& x, F77_INT k, F77_INT rows, F77_INT cols,
+          bool trans, double* dst)
+{
+    const double* src = x.data ();
+
+    if (x.ndims () > 2 && x.dims ()(2) > 1)
+        src += static_cast<octave_idx_type> (k) * rows * cols;
+
+    if (trans)
+    {
+        for (F77_INT j = 0; j < cols; j++)
+            for (F77_INT i = 0; i < rows; i++)
+                dst[i + j*rows] = src[j + i*cols];
+    }
+    else
+    {
+        for (F77_INT i = 0; i < rows*cols; i++)
+            dst[i] = src[i];
+    }
+}
+
+static bool
+rde_is_tv (const NDArray& x)
+{
+    return x.ndims () > 2 && x.dims ()(2) > 1;
+}
+
+// compute a square-root factor F of the symmetric positive semidefinite
+// n-by-n matrix s such that s = F'F.  Cholesky is tried first, the
+// eigenvalue decomposition is used as fallback for singular matrices.
+// Returns false if s is indefinite.
+static bool
+rde_factor (F77_INT n, const double* s, double* f)
+{
+    char uplo = 'U';
+    char jobz = 'V';
+    F77_INT info;
+
+    for (F77_INT j = 0; j < n; j++)
+        for (F77_INT i = 0; i < n; i++)
+            f[i + j*n] = 0.5 * (s[i + j*n] + s[j + i*n]);
+
+    CONTROL_XFCN (dpotrf, DPOTRF, (n, 0, 0, 0), (info), (uplo, n, f, n, info));
+
+    if (info == 0)
+    {
+        for (F77_INT j = 0; j < n; j++)
+            for (F77_INT i = j+1; i < n; i++)
+                f[i + j*n] = 0.0;
+
+        return true;
+    }
+
+    CONTROL_WORK_BUFFER (double, v, n*n);
+    CONTROL_WORK_BUFFER (double, w, n);
+
+    for (F77_INT j = 0; j < n; j++)
+        for (F77_INT i = 0; i < n; i++)
+            v[i + j*n] = 0.5 * (s[i + j*n] + s[j + i*n]);
+
+    F77_INT lwork = max (1, 3*n);
+    CONTROL_WORK_BUFFER (double, work, lwork);
+
+    CONTROL_XFCN (dsyev, DSYEV, (n, 0, 0, lwork), (info), (jobz, uplo, n, v, n, w, work, lwork, info));
+
+    if (info != 0)
+        return false;
+
+    // eigenvalues in ascending order
+    double wmax = std::abs (w[n-1]) > std::abs (w[0]) ? std::abs (w[n-1]) : std::abs (w[0]);
+    double tol = 100 * n * std::numeric_limits<double>::epsilon () * wmax;
+
+    if (w[0] < -tol)
+        return false;
+
+    for (F77_INT i = 0; i < n; i++)
+    {
+        double sw = w[i] > 0 ? std::sqrt (w[i]) : 0.0;
+
+        for (F77_INT j = 0; j < n; j++)
+            f[i + j*n] = sw * v[j + i*n];
+    }
+
+    return true;
+}
+
+// PKG_ADD: autoload ("__sl_rde__", "__control_slicot_riccati__.oct");
+DEFUN_DLD (__sl_rde__, args, nargout,
+   "-*- texinfo -*-\n\
+Finite-horizon discrete-time Riccati difference equation\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin != 8)
+    {
+        print_usage ();
+    }
+    else
+    {
+        // arguments in
+        //   control (ifilt = 0):  a (n-by-n), b (n-by-m), p0 = final weight
+        //   filter  (ifilt = 1):  a (n-by-n), b = c (m-by-n), p0 = initial covariance
+        // all of a, b, q, r, s may be 3-D arrays with nhor pages
+        const NDArray a = args(0).array_value ();
+        const NDArray b = args(1).array_value ();
+        const NDArray q = args(2).array_value ();
+        const NDArray r = args(3).array_value ();
+        const NDArray s = args(4).array_value ();
+        Matrix p0 = args(5).matrix_value ();
+        const double dhor = args(6).double_value ();
+        bool filter = args(7).int_value () != 0;
+
+        // caller in error messages
+        const char* who = filter ? "dlqe: __sl_rde__" : "dlqr: __sl_rde__";
+
+        if (! (dhor >= 1 && dhor == std::floor (dhor)
+               && dhor <= std::numeric_limits<F77_INT>::max () - 1))
+            error ("%s: horizon must be a positive integer", who);
+
+        F77_INT nhor = static_cast<F77_INT> (dhor);
+
+        F77_INT n = TO_F77_INT (a.rows ());
+        F77_INT m = TO_F77_INT (filter ? b.rows () : b.columns ());
+
+        bool tv = rde_is_tv (a) || rde_is_tv (b) || rde_is_tv (q)
+                  || rde_is_tv (r) || rde_is_tv (s);
+        bool has_s = s.numel () > 0;
+
+        // arguments out
+        NDArray kseq (dim_vector (filter ? n : m, filter ? m : n, nhor));
+        NDArray pseq (dim_vector (n, n, nhor + 1));
+        NDArray zseq;
+        NDArray lseq;
+
+        if (filter)
+        {
+            zseq = NDArray (dim_vector (n, n, nhor));
+            lseq = NDArray (dim_vector (n, m, nhor));
+        }
+
+        double* pk = kseq.fortran_vec ();
+        double* pp = pseq.fortran_vec ();
+
+        // step data
+        CONTROL_WORK_BUFFER (double, ak, n*n);      // Abar
+        CONTROL_WORK_BUFFER (double, bk, n*m);
+        CONTROL_WORK_BUFFER (double, qk, n*n);      // Qbar
+        CONTROL_WORK_BUFFER (double, fq, n*n);      // Fq'Fq = Qbar
+        CONTROL_WORK_BUFFER (double, ur, m*m);      // Ur'Ur = R
+        CONTROL_WORK_BUFFER (double, rs, m*n);      // inv(R)*S'
+        CONTROL_WORK_BUFFER (double, sk, n*m);
+
+        // square-root factor of the current solution P
+        CONTROL_WORK_BUFFER (double, up, n*n);
+
+        // pre-array and QR workspace
+        F77_INT ldpre = m + 2*n;
+        F77_INT npre = m + n;
+        CONTROL_WORK_BUFFER (double, pre, ldpre * npre);
+        CONTROL_WORK_BUFFER (double, tau, npre);
+        CONTROL_WORK_BUFFER (double, gk, n*m);
+
+        double one = 1.0;
+        double zero = 0.0;
+        double mone = -1.0;
+        char tn = 'N';
+        char tt = 'T';
+        char sl = 'L';
+        char sr = 'R';
+        char su = 'U';
+
+        F77_INT info;
+
+        // workspace query for DGEQRF, cached per dimensions
+        F77_INT lwork = control_ldwork ("DGEQRF", {ldpre, npre}, npre, 0, [&] ()
+        {
+            F77_INT lquery = -1;
+            double wquery;
+
+            CONTROL_XFCN (dgeqrf, DGEQRF, (ldpre, npre, 0, 0), (info),
+                         (ldpre, npre, pre, ldpre, tau, &wquery, lquery, info));
+
+            return wquery;
+        });
+
+        CONTROL_WORK_BUFFER (double, work, lwork);
+
+        // initial (filter) or final (control) solution
+        p0 = 0.5 * (p0 + p0.transpose ());
+
+        if (! rde_factor (n, p0.data (), up))
+            error ("%s: initial/final weight must be symmetric positive semidefinite", who);
+
+        F77_INT kp0 = filter ? 0 : nhor;
+        std::copy (p0.data (), p0.data () + n*n, pp + kp0*n*n);
+
+        for (F77_INT step = 0; step < nhor; step++)
+        {
+            octave_quit ();
+
+            F77_INT k = filter ? step : nhor - 1 - step;
+
+            // update step data, constant data is computed only once
+            if (tv || step == 0)
+            {
+                rde_page (a, k, n, n, filter, ak);
+                rde_page (b, k, n, m, filter, bk);
+                rde_page (q, k, n, n, false, qk);
+                rde_page (r, k, m, m, false, ur);
+
+                CONTROL_XFCN (dpotrf, DPOTRF, (m, 0, 0, 0), (info), (su, m, ur, m, info));
+
+                if (info != 0)
+                    error ("%s: weighting matrix r must be positive definite", who);
+
+                for (F77_INT j = 0; j < m; j++)
+                    for (F77_INT i = j+1; i < m; i++)
+                        ur[i + j*m] = 0.0;
+
+                if (has_s)
+                {
+                    // rs = inv(R)*S' = inv(Ur)*inv(Ur')*S'
+                    rde_page (s, k, n, m, false, sk);
+
+                    for (F77_INT j = 0; j < n; j++)
+                        for (F77_INT i = 0; i < m; i++)
+                            rs[i + j*m] = sk[j + i*n];
+
+                    CONTROL_XFCN (dtrsm, DTRSM, (m, n, 0, 0), (0),
+                                 (sl, su, tt, tn, m, n, one, ur, m, rs, m));
+                    CONTROL_XFCN (dtrsm, DTRSM, (m, n, 0, 0), (0),
+                                 (sl, su, tn, tn, m, n, one, ur, m, rs, m));
+
+                    // Abar = A - B*rs,  Qbar = Q - S*rs
+                    CONTROL_XFCN (dgemm, DGEMM, (n, n, m, 0), (0),
+                                 (tn, tn, n, n, m, mone, bk, n, rs, m, one, ak, n));
+                    CONTROL_XFCN (dgemm, DGEMM, (n, n, m, 0), (0),
+                                 (tn, tn, n, n, m, mone, sk, n, rs, m, one, qk, n));
+                }
+
+                if (! rde_factor (n, qk, fq))
+                    error ("%s: q - s*inv(r)*s' must be positive semidefinite", who);
+            }
+
+            // filter gain  M = P*C'*inv(C*P*C' + R)  needs P(k) = U'U
+            if (filter)
+                CONTROL_XFCN (dgemm, DGEMM, (n, m, n, 0), (0),
+                             (tn, tn, n, m, n, one, pp + k*n*n, n, bk, n, zero, gk, n));
+
+            // assemble pre-array
+            std::fill (pre, pre + ldpre*npre, 0.0);
+
+            for (F77_INT j = 0; j < m; j++)
+                for (F77_INT i = 0; i <= j; i++)
+                    pre[i + j*ldpre] = ur[i + j*m];
+
+            CONTROL_XFCN (dgemm, DGEMM, (n, m, n, 0), (0),
+                         (tn, tn, n, m, n, one, up, n, bk, n, zero, pre + m, ldpre));
+            CONTROL_XFCN (dgemm, DGEMM, (n, n, n, 0), (0),
+                         (tn, tn, n, n, n, one, up, n, ak, n, zero, pre + m + m*ldpre, ldpre));
+
+            for (F77_INT j = 0; j < n; j++)
+                for (F77_INT i = 0; i < n; i++)
+                    pre[m + n + i + (m + j)*ldpre] = fq[i + j*n];
+
+            CONTROL_XFCN (dgeqrf, DGEQRF, (ldpre, npre, 0, lwork), (info),
+                         (ldpre, npre, pre, ldpre, tau, work, lwork, info));
+
+            if (info != 0)
+                error ("%s: QR factorization failed in step %d",
+                       who, static_cast<int> (k));
+
+            // K = inv(X)*Y + inv(R)*S',  X = pre(1:m,1:m),  Y = pre(1:m,m+1:m+n)
+            double* xk = pre;
+            double* yk = pre + m*ldpre;
+
+            CONTROL_XFCN (dtrsm, DTRSM, (m, n, 0, 0), (0),
+                         (sl, su, tn, tn, m, n, one, xk, ldpre, yk, ldpre));
+
+            if (filter)
+            {
+                // predictor gain  L = K'
+                double* pl = lseq.fortran_vec () + k*n*m;
+
+                for (F77_INT j = 0; j < m; j++)
+                    for (F77_INT i = 0; i < n; i++)
+                        pl[i + j*n] = yk[j + i*ldpre] + (has_s ? rs[j + i*m] : 0.0);
+
+                // filter gain  M = P*C'*inv(X)*inv(X'),  Z = P - M*(P*C')'
+                double* pm = pk + k*n*m;
+                std::copy (gk, gk + n*m, pm);
+
+                CONTROL_XFCN (dtrsm, DTRSM, (n, m, 0, 0), (0),
+                             (sr, su, tn, tn, n, m, one, xk, ldpre, pm, n));
+                CONTROL_XFCN (dtrsm, DTRSM, (n, m, 0, 0), (0),
+                             (sr, su, tt, tn, n, m, one, xk, ldpre, pm, n));
+
+                double* pz = zseq.fortran_vec () + k*n*n;
+                std::copy (pp + k*n*n, pp + (k+1)*n*n, pz);
+
+                CONTROL_XFCN (dgemm, DGEMM, (n, n, m, 0), (0),
+                             (tn, tt, n, n, m, mone, pm, n, gk, n, one, pz, n));
+            }
+            else
+            {
+                double* pg = pk + k*m*n;
+
+                for (F77_INT j = 0; j < n; j++)
+                    for (F77_INT i = 0; i < m; i++)
+                        pg[i + j*m] = yk[i + j*ldpre] + (has_s ? rs[i + j*m] : 0.0);
+            }
+
+            // new square-root factor  U = Z  and solution  P = Z'Z
+            for (F77_INT j = 0; j < n; j++)
+                for (F77_INT i = 0; i < n; i++)
+                    up[i + j*n] = (i <= j) ? pre[m + i + (m + j)*ldpre] : 0.0;
+
+            F77_INT kn = filter ? k + 1 : k;
+            double* pn = pp + kn*n*n;
+
+            CONTROL_XFCN (dgemm, DGEMM, (n, n, n, 0), (0),
+                         (tt, tn, n, n, n, one, up, n, up, n, zero, pn, n));
+        }
+
+        if (f77_exception_encountered)
+            error ("%s: exception in LAPACK/BLAS subroutine", who);
+
+        // return values
+        retval(0) = kseq;
+        retval(1) = pseq;
+
+        if (filter)
+        {
+            retval(2) = zseq;
+            retval(3) = lseq;
+        }
+    }
+
+    return retval;
+}
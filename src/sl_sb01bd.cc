@@ -23,7 +23,7 @@ Uses SLICOT SB01BD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: November 2009
-Version: 0.6
+Version: 0.7
 
 */
 
@@ -47,7 +47,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb01bd__", "__control_slicot_functions__.oct");     
+// PKG_ADD: autoload ("__sl_sb01bd__", "__control_slicot_synthesis__.oct");     
 DEFUN_DLD (__sl_sb01bd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB01BD Release 5.0\n\
@@ -99,7 +99,7 @@ For internal use only.")
         // workspace
         F77_INT ldwork = max (1, 5*m, 5*n, 2*n+4*m);
         
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT iwarn;
@@ -107,19 +107,19 @@ For internal use only.")
 
 
         // SLICOT routine SB01BD
-        F77_XFCN (sb01bd, SB01BD,
-                 (dico,
-                  n, m, np,
-                  alpha,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  wr.fortran_vec (), wi.fortran_vec (),
-                  nfp, nap, nup,
-                  f.fortran_vec (), ldf,
-                  z.fortran_vec (), ldz,
-                  tol,
-                  dwork, ldwork,
-                  iwarn, info));
+        CONTROL_XFCN (sb01bd, SB01BD, (n, m, np, ldwork), (info, iwarn),
+                     (dico,
+                      n, m, np,
+                      alpha,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      wr.fortran_vec (), wi.fortran_vec (),
+                      nfp, nap, nup,
+                      f.fortran_vec (), ldf,
+                      z.fortran_vec (), ldz,
+                      tol,
+                      dwork, ldwork,
+                      iwarn, info));
 
         if (f77_exception_encountered)
             error ("place: __sl_sb01bd__: exception in SLICOT subroutine SB01BD");
@@ -17,13 +17,13 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
 
-Solve algebraic Riccati equation.
+Solve algebraic Riccati equation, also for batches of equations.
 Uses SLICOT SB02OD by courtesy of NICONET e.V.
 <http://www.slicot.org>
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: February 2010
-Version: 0.5
+Version: 0.9
 
 */
 
@@ -57,7 +57,151 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb02od__", "__control_slicot_functions__.oct");    
+// Riccati equation of one call of __sl_sb02od__, see control_batch_item
+struct sb02od_problem : control_batch_item
+{
+    sb02od_problem (const octave_value_list& args, const std::string& who);
+    void run (bool worker);
+    octave_value_list result () const;
+
+    // arguments in
+    char dico;
+    char jobb = 'B';
+    char fact = 'N';
+    char uplo = 'U';
+    char jobl;
+    char sort = 'S';
+
+    Matrix a, b, q, r, l;
+    F77_INT n, m;
+    F77_INT p = 0;              // p: number of outputs, not used because FACT = 'N'
+
+    // arguments out
+    double rcond = 0;
+
+    Matrix x;
+    ColumnVector alfar, alfai, beta;
+    Matrix s;
+
+    // workspace
+    F77_INT ldwork;
+};
+
+sb02od_problem::sb02od_problem (const octave_value_list& args, const std::string& who)
+{
+    a = args(0).matrix_value ();
+    b = args(1).matrix_value ();
+    q = args(2).matrix_value ();
+    r = args(3).matrix_value ();
+    l = args(4).matrix_value ();
+    F77_INT discrete = args(5).int_value ();
+    F77_INT ijobl = args(6).int_value ();
+
+    if (discrete == 0)
+        dico = 'C';
+    else
+        dico = 'D';
+
+    if (ijobl == 0)
+        jobl = 'Z';
+    else
+        jobl = 'N';
+
+    n = TO_F77_INT (a.rows ());      // n: number of states
+    m = TO_F77_INT (b.columns ());   // m: number of inputs
+
+    if (a.columns () != n || b.rows () != n
+        || q.rows () != n || q.columns () != n
+        || r.rows () != m || r.columns () != m
+        || (jobl == 'N' && (l.rows () != n || l.columns () != m)))
+        error ("%s: dimensions of A, B, Q, R and S do not match", who.c_str ());
+
+    x = Matrix (max (1, n), n);
+
+    F77_INT nu = 2*n;
+    alfar = ColumnVector (nu);
+    alfai = ColumnVector (nu);
+    beta = ColumnVector (nu);
+
+    F77_INT lds = max (1, 2*n + m);
+    s = Matrix (lds, lds);
+
+    ldwork = control_ldwork ("SB02OD", {n, m},
+                             max (7*(2*n + 1) + 16, 16*n, 2*n + m, 3*m), 2*n);
+}
+
+void sb02od_problem::run (bool worker)
+{
+    F77_INT lda = max (1, n);
+    F77_INT ldb = max (1, n);
+    F77_INT ldq = max (1, n);
+    F77_INT ldr = max (1, m);
+    F77_INT ldl = max (1, n);
+    F77_INT ldx = max (1, n);
+    F77_INT lds = max (1, 2*n + m);
+
+    // unused output arguments
+    F77_INT ldt = max (1, 2*n + m);
+    CONTROL_WORK_BUFFER (double, t, ldt * 2*n);
+
+    F77_INT ldu = max (1, 2*n);
+    CONTROL_WORK_BUFFER (double, u, ldu * 2*n);
+
+    // tolerance
+    double tol = 0;  // use default value
+
+    // workspace
+    F77_INT liwork = max (1, m, 2*n);
+    CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+    CONTROL_WORK_BUFFER (double, dwork, ldwork);
+    CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
+
+    // SLICOT routine SB02OD
+    CONTROL_CALL (worker, sb02od, SB02OD, (n, m, p, ldwork), (info),
+                (dico, jobb,
+                 fact, uplo,
+                 jobl, sort,
+                 n, m, p,
+                 control_input (a), lda,
+                 control_input (b), ldb,
+                 control_input (q), ldq,
+                 control_input (r), ldr,
+                 control_input (l), ldl,
+                 rcond,
+                 x.fortran_vec (), ldx,
+                 alfar.fortran_vec (), alfai.fortran_vec (),
+                 beta.fortran_vec (),
+                 s.fortran_vec (), lds,
+                 t, ldt,
+                 u, ldu,
+                 tol,
+                 iwork,
+                 dwork, ldwork,
+                 bwork,
+                 info));
+}
+
+octave_value_list sb02od_problem::result () const
+{
+    octave_value_list retval;
+
+    // assemble complex vector - adapted from DEFUN complex in data.cc
+    ComplexColumnVector pole (n, Complex ());
+
+    for (F77_INT i = 0; i < n; i++)
+        pole.xelem (i) = Complex (alfar(i) / beta(i), alfai(i) / beta(i));
+
+    // return value
+    retval(0) = x;
+    retval(1) = pole;
+
+    return retval;
+}
+
+static const bool sb02od_batch
+    = control_batch_register ("__sl_sb02od__", 7, 7, control_batch_make<sb02od_problem>);
+
+// PKG_ADD: autoload ("__sl_sb02od__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_sb02od__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB02OD Release 5.0\n\
@@ -73,102 +217,9 @@ For internal use only.")
     }
     else
     {
-        // arguments in
-        char dico;
-        char jobb = 'B';
-        char fact = 'N';
-        char uplo = 'U';
-        char jobl;
-        char sort = 'S';
-
-        Matrix a = args(0).matrix_value ();
-        Matrix b = args(1).matrix_value ();
-        Matrix q = args(2).matrix_value ();
-        Matrix r = args(3).matrix_value ();
-        Matrix l = args(4).matrix_value ();
-        F77_INT discrete = args(5).int_value ();
-        F77_INT ijobl = args(6).int_value ();
-
-        if (discrete == 0)
-            dico = 'C';
-        else
-            dico = 'D';
-
-        if (ijobl == 0)
-            jobl = 'Z';
-        else
-            jobl = 'N';
-
-        F77_INT n = TO_F77_INT (a.rows ());      // n: number of states
-        F77_INT m = TO_F77_INT (b.columns ());   // m: number of inputs
-        F77_INT p = 0;              // p: number of outputs, not used because FACT = 'N'
-
-        F77_INT lda = max (1, n);
-        F77_INT ldb = max (1, n);
-        F77_INT ldq = max (1, n);
-        F77_INT ldr = max (1, m);
-        F77_INT ldl = max (1, n);
-
-        // arguments out
-        double rcond;
-
-        F77_INT ldx = max (1, n);
-        Matrix x (ldx, n);
-
-        F77_INT nu = 2*n;
-        ColumnVector alfar (nu);
-        ColumnVector alfai (nu);
-        ColumnVector beta (nu);
-
-        F77_INT lds = max (1, 2*n + m);
-        Matrix s (lds, lds);
-
-        // unused output arguments
-        F77_INT ldt = max (1, 2*n + m);
-        OCTAVE_LOCAL_BUFFER (double, t, ldt * 2*n);
-
-        F77_INT ldu = max (1, 2*n);
-        OCTAVE_LOCAL_BUFFER (double, u, ldu * 2*n);
-
-        // tolerance
-        double tol = 0;  // use default value
-
-        // workspace
-        F77_INT liwork = max (1, m, 2*n);
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-
-        F77_INT ldwork = max (7*(2*n + 1) + 16, 16*n, 2*n + m, 3*m);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
-
-        // error indicator
-        F77_INT info;
-
-
-        // SLICOT routine SB02OD
-        F77_XFCN (sb02od, SB02OD,
-                 (dico, jobb,
-                  fact, uplo,
-                  jobl, sort,
-                  n, m, p,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  q.fortran_vec (), ldq,
-                  r.fortran_vec (), ldr,
-                  l.fortran_vec (), ldl,
-                  rcond,
-                  x.fortran_vec (), ldx,
-                  alfar.fortran_vec (), alfai.fortran_vec (),
-                  beta.fortran_vec (),
-                  s.fortran_vec (), lds,
-                  t, ldt,
-                  u, ldu,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  info));
+        sb02od_problem pr (args, "are: __sl_sb02od__");
+
+        pr.run (false);
 
         if (f77_exception_encountered)
             error ("are: __sl_sb02od__: exception in SLICOT subroutine SB02OD");
@@ -190,28 +241,10 @@ For internal use only.")
             "6: a singular matrix was encountered during the "
                 "computation of the solution matrix X"};
 
-        error_msg ("are", info, 6, err_msg);
-
-
-        // assemble complex vector - adapted from DEFUN complex in data.cc
-        alfar.resize (n);
-        alfai.resize (n);
-        beta.resize (n);
-
-        ColumnVector poler (n);
-        ColumnVector polei (n);
-
-        poler = quotient (alfar, beta);
-        polei = quotient (alfai, beta);
-        
-        ComplexColumnVector pole (n, Complex ());
-
-        for (F77_INT i = 0; i < n; i++)
-            pole.xelem (i) = Complex (poler(i), polei(i));
+        error_msg ("are", pr.info, 6, err_msg);
 
-        // return value
-        retval(0) = x;
-        retval(1) = pole;
+        // return values
+        retval = pr.result ();
     }
 
     return retval;
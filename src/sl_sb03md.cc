@@ -17,13 +17,13 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
 
-Solution of Lyapunov equations.
+Solution of Lyapunov equations, also for batches of equations.
 Uses SLICOT SB03MD by courtesy of NICONET e.V.
 <http://www.slicot.org>
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: December 2009
-Version: 0.4
+Version: 0.8
 
 */
 
@@ -47,7 +47,119 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb03md__", "__control_slicot_functions__.oct");    
+// Lyapunov equation of one call of __sl_sb03md__, see control_batch_item
+struct sb03md_problem : control_batch_item
+{
+    sb03md_problem (const octave_value_list& args, const std::string& who);
+    void run (bool worker);
+    octave_value_list result () const;
+
+    // arguments in
+    char dico;
+    char job = 'X';
+    char fact = 'N';
+    char trana = 'T';
+
+    Matrix a, c;
+    F77_INT n;
+
+    // arguments out
+    double scale = 0;
+    double sep = 0;
+    double ferr = 0;
+
+    Matrix u;
+    ColumnVector wr, wi;
+
+    // workspace
+    F77_INT ldwork;
+};
+
+sb03md_problem::sb03md_problem (const octave_value_list& args, const std::string& who)
+{
+    a = args(0).matrix_value ();
+    c = args(1).matrix_value ();
+    F77_INT discrete = args(2).int_value ();
+
+    if (discrete == 0)
+      dico = 'C';
+    else
+      dico = 'D';
+
+    n = TO_F77_INT (a.rows ());      // n: number of states
+
+    if (a.columns () != n || c.rows () != n || c.columns () != n)
+        error ("%s: A and C must be square matrices of the same size", who.c_str ());
+
+    u = Matrix (max (1, n), n);
+
+    // optional:  a in real Schur form with orthogonal factor u,
+    // reused for several equations with the same coefficient
+    if (args.length () == 5)
+    {
+        Matrix uf = args(3).matrix_value ();
+
+        if (uf.rows () == n && uf.columns () == n)
+        {
+            fact = 'F';
+            u = uf;
+        }
+
+        if (args(4).int_value () != 0)
+            trana = 'N';    // A'X + XA = C,  A'XA - X = C
+    }
+
+    wr = ColumnVector (n);
+    wi = ColumnVector (n);
+
+    ldwork = control_ldwork ("SB03MD", {n}, max (n*n, 3*n), n);
+
+    // a, u and c are overwritten, copies are made here
+    a.fortran_vec ();
+    u.fortran_vec ();
+    c.fortran_vec ();
+}
+
+void sb03md_problem::run (bool worker)
+{
+    F77_INT lda = max (1, n);
+    F77_INT ldu = max (1, n);
+    F77_INT ldc = max (1, n);
+
+    // workspace
+    F77_INT* iwork = 0;  // not referenced because job = X
+    CONTROL_WORK_BUFFER (double, dwork, ldwork);
+
+    // SLICOT routine SB03MD
+    CONTROL_CALL (worker, sb03md, SB03MD, (n, 0, 0, ldwork), (info),
+                (dico, job,
+                 fact, trana,
+                 n,
+                 a.fortran_vec (), lda,
+                 u.fortran_vec (), ldu,
+                 c.fortran_vec (), ldc,
+                 scale,
+                 sep, ferr,
+                 wr.fortran_vec (), wi.fortran_vec (),
+                 iwork,
+                 dwork, ldwork,
+                 info));
+}
+
+octave_value_list sb03md_problem::result () const
+{
+    octave_value_list retval;
+
+    retval(0) = c;
+    retval(1) = octave_value (scale);
+
+    return retval;
+}
+
+static const bool sb03md_batch
+    = control_batch_register ("__sl_sb03md__", 3, 5, control_batch_make<sb03md_problem>);
+
+// PKG_ADD: autoload ("__sl_sb03md__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_sb03md__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB03MD Release 5.0\n\
@@ -57,76 +169,24 @@ For internal use only.")
     octave_idx_type nargin = args.length ();
     octave_value_list retval;
     
-    if (nargin != 3)
+    if (nargin != 3 && nargin != 5)
     {
         print_usage ();
     }
     else
     {
-        // arguments in
-        char dico;
-        char job = 'X';
-        char fact = 'N';
-        char trana = 'T';
-        
-        Matrix a = args(0).matrix_value ();
-        Matrix c = args(1).matrix_value ();
-        F77_INT discrete = args(2).int_value ();
-        
-        if (discrete == 0)
-          dico = 'C';
-        else
-          dico = 'D';
-        
-        F77_INT n = TO_F77_INT (a.rows ());      // n: number of states
-        
-        F77_INT lda = max (1, n);
-        F77_INT ldu = max (1, n);
-        F77_INT ldc = max (1, n);
-        
-        // arguments out
-        double scale;
-        double sep = 0;
-        double ferr = 0;
-        
-        Matrix u (ldu, n);
-        ColumnVector wr (n);
-        ColumnVector wi (n);
-        
-        // workspace
-        F77_INT* iwork = 0;  // not referenced because job = X
-        
-        F77_INT ldwork = max (n*n, 3*n);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-
-        // error indicator
-        F77_INT info;
-        
+        sb03md_problem pr (args, "lyap: __sl_sb03md__");
 
-        // SLICOT routine SB03MD
-        F77_XFCN (sb03md, SB03MD,
-                 (dico, job,
-                  fact, trana,
-                  n,
-                  a.fortran_vec (), lda,
-                  u.fortran_vec (), ldu,
-                  c.fortran_vec (), ldc,
-                  scale,
-                  sep, ferr,
-                  wr.fortran_vec (), wi.fortran_vec (),
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        pr.run (false);
 
         if (f77_exception_encountered)
             error ("lyap: __sl_sb03md__: exception in SLICOT subroutine SB03MD");
 
-        if (info != 0)
-            error ("lyap: __sl_sb03md__: SB03MD returned info = %d", static_cast<int> (info));
+        if (pr.info != 0)
+            error ("lyap: __sl_sb03md__: SB03MD returned info = %d", static_cast<int> (pr.info));
         
         // return values
-        retval(0) = c;
-        retval(1) = octave_value (scale);
+        retval = pr.result ();
     }
     
     return retval;
@@ -23,7 +23,7 @@ Uses SLICOT SB03OD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: January 2010
-Version: 0.3
+Version: 0.5
 
 */
 
@@ -44,7 +44,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb03od__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb03od__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_sb03od__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB03OD Release 5.0\n\
@@ -95,25 +95,25 @@ For internal use only.")
         ColumnVector wi (n);
         
         // workspace
-        F77_INT ldwork = max (1, 4*n + min (m, n));
+        F77_INT ldwork = control_ldwork ("SB03OD", {n, m}, max (1, 4*n + min (m, n)), n);
         
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
 
         // error indicator
         F77_INT info;
         
 
         // SLICOT routine SB03OD
-        F77_XFCN (sb03od, SB03OD,
-                 (dico, fact, trans,
-                  n, m,
-                  a.fortran_vec (), lda,
-                  q.fortran_vec (), ldq,
-                  b.fortran_vec (), ldb,
-                  scale,
-                  wr.fortran_vec (), wi.fortran_vec (),
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (sb03od, SB03OD, (n, m, 0, ldwork), (info),
+                     (dico, fact, trans,
+                      n, m,
+                      a.fortran_vec (), lda,
+                      q.fortran_vec (), ldq,
+                      b.fortran_vec (), ldb,
+                      scale,
+                      wr.fortran_vec (), wi.fortran_vec (),
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("lyapchol: __sl_sb03od__: exception in SLICOT subroutine SB03OD");
@@ -23,7 +23,7 @@ Uses SLICOT SB04MD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: January 2010
-Version: 0.3
+Version: 0.4
 
 */
 
@@ -43,7 +43,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb04md__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb04md__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_sb04md__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB04MD Release 5.0\n\
@@ -78,23 +78,23 @@ For internal use only.")
         // workspace
         F77_INT ldwork = max (1, 2*n*n + 8*n, 5*m, n + m);
         
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, 4*n);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, 4*n);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
 
         // error indicator
         F77_INT info;
         
 
         // SLICOT routine SB04MD
-        F77_XFCN (sb04md, SB04MD,
-                 (n, m,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  z.fortran_vec (), ldz,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (sb04md, SB04MD, (n, m, 0, ldwork), (info),
+                     (n, m,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      z.fortran_vec (), ldz,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("lyap: __sl_sb04md__: exception in SLICOT subroutine SB04MD");
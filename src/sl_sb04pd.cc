@@ -0,0 +1,171 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Solution of Sylvester equations with optionally precomputed
+real Schur factorizations of the coefficient matrices.
+Uses SLICOT SB04PD by courtesy of NICONET e.V.
+<http://www.slicot.org>
+
+Created: October 2026
+Version: 0.2
+
+*/
+
+#include <octave/oct.h>
+#include "common.h"
+
+extern "C"
+{
+    int F77_FUNC (sb04pd, SB04PD)
+                 (char& DICO, char& FACTA, char& FACTB,
+                  char& TRANA, char& TRANB,
+                  F77_INT& ISGN,
+                  F77_INT& M, F77_INT& N,
+                  double* A, F77_INT& LDA,
+                  double* U, F77_INT& LDU,
+                  double* B, F77_INT& LDB,
+                  double* V, F77_INT& LDV,
+                  double* C, F77_INT& LDC,
+                  double& SCALE,
+                  double* DWORK, F77_INT& LDWORK,
+                  F77_INT& INFO);
+}
+
+// PKG_ADD: autoload ("__sl_sb04pd__", "__control_slicot_riccati__.oct");
+DEFUN_DLD (__sl_sb04pd__, args, nargout,
+   "-*- texinfo -*-\n\
+Slicot SB04PD Release 5.0\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin != 8)
+    {
+        print_usage ();
+    }
+    else
+    {
+        // arguments in
+        char dico;
+        char facta;
+        char factb;
+        char trana = 'N';
+        char tranb = 'N';
+
+        Matrix a = args(0).matrix_value ();
+        Matrix u = args(1).matrix_value ();
+        Matrix b = args(2).matrix_value ();
+        Matrix v = args(3).matrix_value ();
+        Matrix c = args(4).matrix_value ();
+        F77_INT discrete = args(5).int_value ();
+        F77_INT isgn = args(6).int_value ();
+        F77_INT ifact = args(7).int_value ();   // bit 0: a factored, bit 1: b factored
+
+        if (discrete == 0)
+            dico = 'C';
+        else
+            dico = 'D';
+
+        // caller in error messages
+        const char* who = (dico == 'C') ? "lyap: __sl_sb04pd__" : "dlyap: __sl_sb04pd__";
+
+        // FACT = 'F':  a = u*t*u' with t in real Schur form is given
+        // FACT = 'N':  compute the Schur factorization
+        if (ifact & 1)
+            facta = 'F';
+        else
+            facta = 'N';
+
+        if (ifact & 2)
+            factb = 'F';
+        else
+            factb = 'N';
+
+        F77_INT m = TO_F77_INT (a.rows ());
+        F77_INT n = TO_F77_INT (b.rows ());
+
+        if (facta == 'N')
+            u.resize (m, m);
+
+        if (factb == 'N')
+            v.resize (n, n);
+
+        F77_INT lda = max (1, m);
+        F77_INT ldu = max (1, m);
+        F77_INT ldb = max (1, n);
+        F77_INT ldv = max (1, n);
+        F77_INT ldc = max (1, m);
+
+        // arguments out
+        double scale;
+
+        // workspace
+        F77_INT wa = (facta == 'N') ? 1 + 2*m : 0;
+        F77_INT wb = (factb == 'N') ? 1 + 2*n : 0;
+        F77_INT wc = (facta == 'N') ? max (1, 4*m) : m;
+        F77_INT wd = (factb == 'N') ? max (1, 4*n) : n;
+        F77_INT we = 2*m;
+
+        F77_INT ldwork = max (1, wa + max (wc, wb + wd, wb + we));
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+
+        // error indicator
+        F77_INT info;
+
+
+        // SLICOT routine SB04PD
+        CONTROL_XFCN (sb04pd, SB04PD, (n, m, 0, ldwork), (info),
+                     (dico, facta, factb,
+                      trana, tranb,
+                      isgn,
+                      m, n,
+                      a.fortran_vec (), lda,
+                      u.fortran_vec (), ldu,
+                      b.fortran_vec (), ldb,
+                      v.fortran_vec (), ldv,
+                      c.fortran_vec (), ldc,
+                      scale,
+                      dwork, ldwork,
+                      info));
+
+        if (f77_exception_encountered)
+            error ("%s: exception in SLICOT subroutine SB04PD", who);
+
+        if (info == m + n + 1)
+            warning ("%s: the coefficient matrices have common "
+                     "or very close eigenvalues, perturbed values were used "
+                     "to solve the equation", who);
+        else if (info > 0 && info <= m)
+            error ("%s: the QR algorithm failed to compute "
+                   "the Schur factorization of the first coefficient matrix", who);
+        else if (info > m && info <= m + n)
+            error ("%s: the QR algorithm failed to compute "
+                   "the Schur factorization of the second coefficient matrix", who);
+        else if (info != 0)
+            error ("%s: SB04PD returned info = %d", who, static_cast<int> (info));
+
+        // return values
+        retval(0) = c;
+        retval(1) = scale;
+    }
+
+    return retval;
+}
@@ -23,7 +23,7 @@ Uses SLICOT SB04QD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: January 2010
-Version: 0.3
+Version: 0.4
 
 */
 
@@ -43,7 +43,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb04qd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb04qd__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_sb04qd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB04QD Release 5.0\n\
@@ -78,23 +78,23 @@ For internal use only.")
         // workspace
         F77_INT ldwork = max (1, 2*n*n + 9*n, 5*m, n + m);
         
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, 4*n);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, 4*n);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
 
         // error indicator
         F77_INT info;
         
 
         // SLICOT routine SB04QD
-        F77_XFCN (sb04qd, SB04QD,
-                 (n, m,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  z.fortran_vec (), ldz,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (sb04qd, SB04QD, (n, m, 0, ldwork), (info),
+                     (n, m,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      z.fortran_vec (), ldz,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("dlyap: __sl_sb04qd__: exception in SLICOT subroutine SB04QD");
@@ -24,7 +24,7 @@ Uses SLICOT SB10AD by courtesy of NICONET e.V.
 
 Author: Thomas Vasileiou <thomas-v@wildmail.com>
 Created: January 2014
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -58,7 +58,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10ad__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10ad__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10ad__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10AD Release 5.0\n\
@@ -156,38 +156,38 @@ For internal use only.")
         F77_INT ldwork = lw1 + max (1, lw2, lw3, lw4, lw5 + max (lw6,lw7));
         F77_INT lbwork = 2*n;
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, lbwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, lbwork);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10AD
-        F77_XFCN (sb10ad, SB10AD,
-                 (job,
-                  n, m, np,
-                  ncon, nmeas,
-                  gamma,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  ak.fortran_vec (), ldak,
-                  bk.fortran_vec (), ldbk,
-                  ck.fortran_vec (), ldck,
-                  dk.fortran_vec (), lddk,
-                  ac.fortran_vec (), ldac,
-                  bc.fortran_vec (), ldbc,
-                  cc.fortran_vec (), ldcc,
-                  dc.fortran_vec (), lddc,
-                  rcond.fortran_vec (),
-                  gtol, actol,
-                  iwork, liwork,
-                  dwork, ldwork,
-                  bwork, lbwork,
-                  info));
+        CONTROL_XFCN (sb10ad, SB10AD, (n, m, np, ldwork), (info),
+                     (job,
+                      n, m, np,
+                      ncon, nmeas,
+                      gamma,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      ak.fortran_vec (), ldak,
+                      bk.fortran_vec (), ldbk,
+                      ck.fortran_vec (), ldck,
+                      dk.fortran_vec (), lddk,
+                      ac.fortran_vec (), ldac,
+                      bc.fortran_vec (), ldbc,
+                      cc.fortran_vec (), ldcc,
+                      dc.fortran_vec (), lddc,
+                      rcond.fortran_vec (),
+                      gtol, actol,
+                      iwork, liwork,
+                      dwork, ldwork,
+                      bwork, lbwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("hinfsyn: __sl_sb10ad__: exception in SLICOT subroutine SB10AD");
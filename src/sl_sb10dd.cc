@@ -23,7 +23,7 @@ Uses SLICOT SB10DD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: December 2009
-Version: 0.6
+Version: 0.7
 
 */
 
@@ -54,7 +54,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10dd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10dd__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10dd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10DD Release 5.0\n\
@@ -120,35 +120,35 @@ For internal use only.")
                      max (m*(m+7*n), 2*q*(8*n+m+2*q)) + 6*n +
                      max (14*n+23, 16*n, 2*n + max (m, 2*q), 3*max (m, 2*q)));
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10DD
-        F77_XFCN (sb10dd, SB10DD,
-                 (n, m, np,
-                  ncon, nmeas,
-                  gamma,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  ak.fortran_vec (), ldak,
-                  bk.fortran_vec (), ldbk,
-                  ck.fortran_vec (), ldck,
-                  dk.fortran_vec (), lddk,
-                  x.fortran_vec (), ldx,
-                  z.fortran_vec (), ldz,
-                  rcond.fortran_vec (),
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  info));
+        CONTROL_XFCN (sb10dd, SB10DD, (n, m, np, ldwork), (info),
+                     (n, m, np,
+                      ncon, nmeas,
+                      gamma,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      ak.fortran_vec (), ldak,
+                      bk.fortran_vec (), ldbk,
+                      ck.fortran_vec (), ldck,
+                      dk.fortran_vec (), lddk,
+                      x.fortran_vec (), ldx,
+                      z.fortran_vec (), ldz,
+                      rcond.fortran_vec (),
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("hinfsyn: __sl_sb10dd__: exception in SLICOT subroutine SB10DD");
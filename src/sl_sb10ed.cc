@@ -23,7 +23,7 @@ Uses SLICOT SB10ED by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: November 2009
-Version: 0.6
+Version: 0.7
 
 */
 
@@ -51,7 +51,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10ed__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10ed__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10ed__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10ED Release 5.0\n\
@@ -111,32 +111,32 @@ For internal use only.")
                                 q*(n+q+max(q,3))));
         F77_INT liwork = max (2*m2, 2*n, n*n, np2);
         
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10ED
-        F77_XFCN (sb10ed, SB10ED,
-                 (n, m, np,
-                  ncon, nmeas,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  ak.fortran_vec (), ldak,
-                  bk.fortran_vec (), ldbk,
-                  ck.fortran_vec (), ldck,
-                  dk.fortran_vec (), lddk,
-                  rcond.fortran_vec (),
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  info));
+        CONTROL_XFCN (sb10ed, SB10ED, (n, m, np, ldwork), (info),
+                     (n, m, np,
+                      ncon, nmeas,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      ak.fortran_vec (), ldak,
+                      bk.fortran_vec (), ldbk,
+                      ck.fortran_vec (), ldck,
+                      dk.fortran_vec (), lddk,
+                      rcond.fortran_vec (),
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("h2syn: __sl_sb10ed__: exception in SLICOT subroutine SB10ED");
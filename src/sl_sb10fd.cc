@@ -23,7 +23,7 @@ Uses SLICOT SB10FD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: December 2009
-Version: 0.6
+Version: 0.7
 
 */
 
@@ -52,7 +52,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10fd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10fd__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10fd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10FD Release 5.0\n\
@@ -115,33 +115,33 @@ For internal use only.")
                                           max (2*q, 3*n*n + max (2*n*q, 10*n*n+12*n+5)),
                                           q*(3*n + 3*q + max (2*n, 4*q + max (n, q)))));
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10FD
-        F77_XFCN (sb10fd, SB10FD,
-                 (n, m, np,
-                  ncon, nmeas,
-                  gamma,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  ak.fortran_vec (), ldak,
-                  bk.fortran_vec (), ldbk,
-                  ck.fortran_vec (), ldck,
-                  dk.fortran_vec (), lddk,
-                  rcond.fortran_vec (),
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  info));
+        CONTROL_XFCN (sb10fd, SB10FD, (n, m, np, ldwork), (info),
+                     (n, m, np,
+                      ncon, nmeas,
+                      gamma,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      ak.fortran_vec (), ldak,
+                      bk.fortran_vec (), ldbk,
+                      ck.fortran_vec (), ldck,
+                      dk.fortran_vec (), lddk,
+                      rcond.fortran_vec (),
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("hinfsyn: __sl_sb10fd__: exception in SLICOT subroutine SB10FD");
@@ -23,7 +23,7 @@ Uses SLICOT SB10HD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: November 2009
-Version: 0.6
+Version: 0.7
 
 */
 
@@ -51,7 +51,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10hd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10hd__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10hd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10HD Release 5.0\n\
@@ -108,32 +108,32 @@ For internal use only.")
         F77_INT q = max (m1, m2, np1, np2);
         F77_INT ldwork = 2*q*(3*q + 2*n) + max (1, q*(q + max (n, 5) + 1), n*(14*n + 12 + 2*q) + 5);
         
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, max (2*n, n*n));
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, max (2*n, n*n));
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10HD
-        F77_XFCN (sb10hd, SB10HD,
-                 (n, m, np,
-                  ncon, nmeas,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  ak.fortran_vec (), ldak,
-                  bk.fortran_vec (), ldbk,
-                  ck.fortran_vec (), ldck,
-                  dk.fortran_vec (), lddk,
-                  rcond.fortran_vec (),
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  info));
+        CONTROL_XFCN (sb10hd, SB10HD, (n, m, np, ldwork), (info),
+                     (n, m, np,
+                      ncon, nmeas,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      ak.fortran_vec (), ldak,
+                      bk.fortran_vec (), ldbk,
+                      ck.fortran_vec (), ldck,
+                      dk.fortran_vec (), lddk,
+                      rcond.fortran_vec (),
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("h2syn: __sl_sb10hd__: exception in SLICOT subroutine SB10HD");
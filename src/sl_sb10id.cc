@@ -23,7 +23,7 @@ Uses SLICOT SB10ID by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: July 2011
-Version: 0.4
+Version: 0.5
 
 */
 
@@ -50,7 +50,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10id__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10id__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10id__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10ID Release 5.0\n\
@@ -101,31 +101,31 @@ For internal use only.")
         F77_INT ldwork = 10*n*n + m*m + np*np + 2*m*n + 2*n*np + 4*n +
                      5 + max (1, 4*n*n + 8*n);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10ID
-        F77_XFCN (sb10id, SB10ID,
-                 (n, m, np,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  factor, nk,
-                  ak.fortran_vec (), ldak,
-                  bk.fortran_vec (), ldbk,
-                  ck.fortran_vec (), ldck,
-                  dk.fortran_vec (), lddk,
-                  rcond.fortran_vec (),
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  info));
+        CONTROL_XFCN (sb10id, SB10ID, (n, m, np, ldwork), (info),
+                     (n, m, np,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      factor, nk,
+                      ak.fortran_vec (), ldak,
+                      bk.fortran_vec (), ldbk,
+                      ck.fortran_vec (), ldck,
+                      dk.fortran_vec (), lddk,
+                      rcond.fortran_vec (),
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("ncfsyn: __sl_sb10id__: exception in SLICOT subroutine SB10ID");
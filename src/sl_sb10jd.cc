@@ -23,7 +23,7 @@ Uses SLICOT SB10JD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: September 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -44,7 +44,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10jd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10jd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_sb10jd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10JD Release 5.0\n\
@@ -82,23 +82,23 @@ For internal use only.")
         
         // workspace
         F77_INT ldwork = max (1, 2*n*n + 2*n + n*max (5, n + m + np));
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10JD
-        F77_XFCN (sb10jd, SB10JD,
-                 (n, m, np,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  e.fortran_vec (), lde,
-                  nsys,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (sb10jd, SB10JD, (n, m, np, ldwork), (info),
+                     (n, m, np,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      e.fortran_vec (), lde,
+                      nsys,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("__sl_sb10jd__: exception in SLICOT subroutine SB10JD");
@@ -23,7 +23,7 @@ Uses SLICOT SB10KD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: July 2011
-Version: 0.4
+Version: 0.5
 
 */
 
@@ -49,7 +49,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10kd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10kd__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10kd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10KD Release 5.0\n\
@@ -98,30 +98,30 @@ For internal use only.")
                      max (14*n+23, 16*n, 2*n+np+m, 3*(np+m)) +
                      max (n*n, 11*n*np + 2*m*m + 8*np*np + 8*m*n + 4*m*np + np);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10KD
-        F77_XFCN (sb10kd, SB10KD,
-                 (n, m, np,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  factor,
-                  ak.fortran_vec (), ldak,
-                  bk.fortran_vec (), ldbk,
-                  ck.fortran_vec (), ldck,
-                  dk.fortran_vec (), lddk,
-                  rcond.fortran_vec (),
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  info));
+        CONTROL_XFCN (sb10kd, SB10KD, (n, m, np, ldwork), (info),
+                     (n, m, np,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      factor,
+                      ak.fortran_vec (), ldak,
+                      bk.fortran_vec (), ldbk,
+                      ck.fortran_vec (), ldck,
+                      dk.fortran_vec (), lddk,
+                      rcond.fortran_vec (),
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("ncfsyn: slsb10kd: exception in SLICOT subroutine SB10KD");
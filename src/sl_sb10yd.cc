@@ -23,7 +23,7 @@ Uses SLICOT SB10YD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: October 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -49,7 +49,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10yd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10yd__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10yd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10YD Release 5.0\n\
@@ -114,9 +114,9 @@ For internal use only.")
        
         ldwork = max (2, lw1, lw2, lw3, lw4);
         
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (Complex, zwork, lzwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (Complex, zwork, lzwork);
         
         // tolerance
         double tol = 0;
@@ -126,20 +126,20 @@ For internal use only.")
 
 
         // SLICOT routine SB10YD
-        F77_XFCN (sb10yd, SB10YD,
-                 (discfl, flag,
-                  lendat,
-                  rfrdat.fortran_vec (), ifrdat.fortran_vec (),
-                  omega.fortran_vec (),
-                  n,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (),
-                  c.fortran_vec (),
-                  d.fortran_vec (),
-                  tol,
-                  iwork, dwork, ldwork,
-                  zwork, lzwork,
-                  info));
+        CONTROL_XFCN (sb10yd, SB10YD, (n, 0, 0, ldwork), (info),
+                     (discfl, flag,
+                      lendat,
+                      rfrdat.fortran_vec (), ifrdat.fortran_vec (),
+                      omega.fortran_vec (),
+                      n,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (),
+                      c.fortran_vec (),
+                      d.fortran_vec (),
+                      tol,
+                      iwork, dwork, ldwork,
+                      zwork, lzwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("fitfrd: __sl_sb10yd__: exception in SLICOT subroutine SB10YD");
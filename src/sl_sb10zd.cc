@@ -23,7 +23,7 @@ Uses SLICOT SB10ZD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: August 2011
-Version: 0.4
+Version: 0.5
 
 */
 
@@ -51,7 +51,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb10zd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb10zd__", "__control_slicot_synthesis__.oct");    
 DEFUN_DLD (__sl_sb10zd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB10ZD Release 5.0\n\
@@ -103,32 +103,32 @@ For internal use only.")
                      7*n*np + 6*n + 2*(m + np) +
                      max (14*n+23, 16*n, 2*m-1, 2*np-1);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
         
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine SB10ZD
-        F77_XFCN (sb10zd, SB10ZD,
-                 (n, m, np,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  factor,
-                  ak.fortran_vec (), ldak,
-                  bk.fortran_vec (), ldbk,
-                  ck.fortran_vec (), ldck,
-                  dk.fortran_vec (), lddk,
-                  rcond.fortran_vec (),
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  info));
+        CONTROL_XFCN (sb10zd, SB10ZD, (n, m, np, ldwork), (info),
+                     (n, m, np,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      factor,
+                      ak.fortran_vec (), ldak,
+                      bk.fortran_vec (), ldbk,
+                      ck.fortran_vec (), ldck,
+                      dk.fortran_vec (), lddk,
+                      rcond.fortran_vec (),
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("ncfsyn: __sl_sb10zd__: exception in SLICOT subroutine SB10ZD");
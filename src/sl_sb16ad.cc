@@ -24,7 +24,7 @@ Uses SLICOT SB16AD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: November 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -55,7 +55,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb16ad__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb16ad__", "__control_slicot_modred__.oct");    
 DEFUN_DLD (__sl_sb16ad__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB16AD Release 5.0\n\
@@ -230,8 +230,8 @@ For internal use only.")
         lsqred = max (1, 2*nc*nc+5*nc);
         ldwork = 2*nc*nc + max (1, lfreq, lsqred);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT iwarn = 0;
@@ -239,26 +239,26 @@ For internal use only.")
 
 
         // SLICOT routine SB16AD
-        F77_XFCN (sb16ad, SB16AD,
-                 (dico, jobc, jobo, jobmr,
-                  weight, equil, ordsel,
-                  n, m, p,
-                  nc, ncr,
-                  alpha,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  ac.fortran_vec (), ldac,
-                  bc.fortran_vec (), ldbc,
-                  cc.fortran_vec (), ldcc,
-                  dc.fortran_vec (), lddc,
-                  ncs,
-                  hsvc.fortran_vec (),
-                  tol1, tol2,
-                  iwork,
-                  dwork, ldwork,
-                  iwarn, info));
+        CONTROL_XFCN (sb16ad, SB16AD, (n, m, p, ldwork), (info, iwarn),
+                     (dico, jobc, jobo, jobmr,
+                      weight, equil, ordsel,
+                      n, m, p,
+                      nc, ncr,
+                      alpha,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      ac.fortran_vec (), ldac,
+                      bc.fortran_vec (), ldbc,
+                      cc.fortran_vec (), ldcc,
+                      dc.fortran_vec (), lddc,
+                      ncs,
+                      hsvc.fortran_vec (),
+                      tol1, tol2,
+                      iwork,
+                      dwork, ldwork,
+                      iwarn, info));
 
 
         if (f77_exception_encountered)
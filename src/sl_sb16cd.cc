@@ -23,7 +23,7 @@ Uses SLICOT SB16CD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: November 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -50,7 +50,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sb16cd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sb16cd__", "__control_slicot_modred__.oct");    
 DEFUN_DLD (__sl_sb16cd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SB16CD Release 5.0\n\
@@ -163,8 +163,8 @@ For internal use only.")
                               n*(n + max(n,mp) + min(n,mp) + 6));
 
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT iwarn = 0;
@@ -172,22 +172,22 @@ For internal use only.")
 
 
         // SLICOT routine SB16CD
-        F77_XFCN (sb16cd, SB16CD,
-                 (dico, jobd, jobmr, jobcf,
-                  ordsel,
-                  n, m, p,
-                  ncr,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  f.fortran_vec (), ldf,
-                  g.fortran_vec (), ldg,
-                  hsv.fortran_vec (),
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  iwarn, info));
+        CONTROL_XFCN (sb16cd, SB16CD, (n, m, p, ldwork), (info, iwarn),
+                     (dico, jobd, jobmr, jobcf,
+                      ordsel,
+                      n, m, p,
+                      ncr,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      f.fortran_vec (), ldf,
+                      g.fortran_vec (), ldg,
+                      hsv.fortran_vec (),
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      iwarn, info));
 
 
         if (f77_exception_encountered)
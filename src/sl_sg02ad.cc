@@ -23,7 +23,7 @@ Uses SLICOT SG02AD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: October 2010
-Version: 0.4
+Version: 0.6
 
 */
 
@@ -59,7 +59,7 @@ extern "C"
                   F77_INT& IWARN, F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sg02ad__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sg02ad__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_sg02ad__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SG02AD Release 5.0\n\
@@ -128,25 +128,26 @@ For internal use only.")
 
         // unused output arguments
         F77_INT lds = max (1, 2*n + m);
-        OCTAVE_LOCAL_BUFFER (double, s, lds * lds);
+        CONTROL_WORK_BUFFER (double, s, lds * lds);
 
         F77_INT ldt = max (1, 2*n + m);
-        OCTAVE_LOCAL_BUFFER (double, t, ldt * 2*n);
+        CONTROL_WORK_BUFFER (double, t, ldt * 2*n);
 
         F77_INT ldu = max (1, 2*n);
-        OCTAVE_LOCAL_BUFFER (double, u, ldu * 2*n);
+        CONTROL_WORK_BUFFER (double, u, ldu * 2*n);
 
         // tolerance
         double tol = 0;  // use default value
 
         // workspace
         F77_INT liwork = max (1, m, 2*n);
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
 
-        F77_INT ldwork = max (7*(2*n + 1) + 16, 16*n, 2*n + m, 3*m);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        F77_INT ldwork = control_ldwork ("SG02AD", {n, m},
+                                         max (7*(2*n + 1) + 16, 16*n, 2*n + m, 3*m), 2*n);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
 
-        OCTAVE_LOCAL_BUFFER (F77_LOGICAL, bwork, 2*n);
+        CONTROL_WORK_BUFFER (F77_LOGICAL, bwork, 2*n);
 
         // error indicator
         F77_INT iwarn;
@@ -154,30 +155,30 @@ For internal use only.")
 
 
         // SLICOT routine SG02AD
-        F77_XFCN (sg02ad, SG02AD,
-                 (dico, jobb,
-                  fact, uplo,
-                  jobl, scal,
-                  sort, acc,
-                  n, m, p,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  b.fortran_vec (), ldb,
-                  q.fortran_vec (), ldq,
-                  r.fortran_vec (), ldr,
-                  l.fortran_vec (), ldl,
-                  rcondu,
-                  x.fortran_vec (), ldx,
-                  alfar.fortran_vec (), alfai.fortran_vec (),
-                  beta.fortran_vec (),
-                  s, lds,
-                  t, ldt,
-                  u, ldu,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  bwork,
-                  iwarn, info));
+        CONTROL_XFCN (sg02ad, SG02AD, (n, m, p, ldwork), (info, iwarn),
+                     (dico, jobb,
+                      fact, uplo,
+                      jobl, scal,
+                      sort, acc,
+                      n, m, p,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      b.fortran_vec (), ldb,
+                      q.fortran_vec (), ldq,
+                      r.fortran_vec (), ldr,
+                      l.fortran_vec (), ldl,
+                      rcondu,
+                      x.fortran_vec (), ldx,
+                      alfar.fortran_vec (), alfai.fortran_vec (),
+                      beta.fortran_vec (),
+                      s, lds,
+                      t, ldt,
+                      u, ldu,
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      bwork,
+                      iwarn, info));
 
         if (f77_exception_encountered)
             error ("are: __sl_sg02ad__: exception in SLICOT subroutine SG02AD");
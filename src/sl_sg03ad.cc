@@ -23,7 +23,7 @@ Uses SLICOT SG03AD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: January 2010
-Version: 0.3
+Version: 0.5
 
 */
 
@@ -51,7 +51,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sg03ad__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sg03ad__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_sg03ad__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SG03AD Release 5.0\n\
@@ -106,31 +106,31 @@ For internal use only.")
         // workspace
         F77_INT* iwork = 0;  // not referenced because job = X
         
-        F77_INT ldwork = max (1, 8*n+16);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        F77_INT ldwork = control_ldwork ("SG03AD", {n}, max (1, 8*n+16), n);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
 
         // error indicator
         F77_INT info;
         
 
         // SLICOT routine SG03AD
-        F77_XFCN (sg03ad, SG03AD,
-                 (dico, job,
-                  fact, trans,
-                  uplo,
-                  n,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  q.fortran_vec (), ldq,
-                  z.fortran_vec (), ldz,
-                  x.fortran_vec (), ldx,
-                  scale,
-                  sep, ferr,
-                  alphar.fortran_vec (), alphai.fortran_vec (),
-                  beta.fortran_vec (),
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (sg03ad, SG03AD, (n, 0, 0, ldwork), (info),
+                     (dico, job,
+                      fact, trans,
+                      uplo,
+                      n,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      q.fortran_vec (), ldq,
+                      z.fortran_vec (), ldz,
+                      x.fortran_vec (), ldx,
+                      scale,
+                      sep, ferr,
+                      alphar.fortran_vec (), alphai.fortran_vec (),
+                      beta.fortran_vec (),
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("lyap: __sl_sg03ad__: exception in SLICOT subroutine SG03AD");
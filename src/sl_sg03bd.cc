@@ -23,7 +23,7 @@ Uses SLICOT SG03BD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: September 2010
-Version: 0.3
+Version: 0.5
 
 */
 
@@ -47,7 +47,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_sg03bd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_sg03bd__", "__control_slicot_riccati__.oct");    
 DEFUN_DLD (__sl_sg03bd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot SG03BD Release 5.0\n\
@@ -100,28 +100,28 @@ For internal use only.")
         ColumnVector beta (n);
         
         // workspace
-        F77_INT ldwork = 8*n + 16;
+        F77_INT ldwork = control_ldwork ("SG03BD", {n}, 8*n + 16, n);
         
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
 
         // error indicator
         F77_INT info;
         
 
         // SLICOT routine SG03BD
-        F77_XFCN (sg03bd, SG03BD,
-                 (dico, fact, trans,
-                  n, m,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  q.fortran_vec (), ldq,
-                  z.fortran_vec (), ldz,
-                  b.fortran_vec (), ldb,
-                  scale,
-                  alphar.fortran_vec (), alphai.fortran_vec (),
-                  beta.fortran_vec (),
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (sg03bd, SG03BD, (n, m, 0, ldwork), (info),
+                     (dico, fact, trans,
+                      n, m,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      q.fortran_vec (), ldq,
+                      z.fortran_vec (), ldz,
+                      b.fortran_vec (), ldb,
+                      scale,
+                      alphar.fortran_vec (), alphai.fortran_vec (),
+                      beta.fortran_vec (),
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("lyap: __sl_sg03bd__: exception in SLICOT subroutine SG03BD");
@@ -0,0 +1,173 @@
+/*
+
+Copyright (C) 2026   The Octave Project Developers
+
+This file is part of LTI Syncope.
+
+LTI Syncope is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LTI Syncope is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LTI Syncope.  If not, see <http://www.gnu.org/licenses/>.
+
+Solution of discrete-time Lyapunov (Stein) equations
+
+    A X A' - X + B = 0
+
+by the squared Smith (doubling) iteration
+
+    X(0) = B,  A(0) = A
+    X(k+1) = X(k) + A(k) X(k) A(k)',  A(k+1) = A(k)^2
+
+which sums 2^k terms of the series X = sum A^j B A'^j in k steps.
+Only BLAS-3 matrix products (DGEMM) are used.  The iteration converges
+for Schur stable A.
+
+Created: October 2026
+Version: 0.2
+
+*/
+
+#include <octave/oct.h>
+#include "common.h"
+#include <cmath>
+#include <algorithm>
+
+extern "C"
+{
+    int F77_FUNC (dgemm, DGEMM)
+                 (char& TRANSA, char& TRANSB,
+                  F77_INT& M, F77_INT& N, F77_INT& K,
+                  double& ALPHA,
+                  const double* A, F77_INT& LDA,
+                  const double* B, F77_INT& LDB,
+                  double& BETA,
+                  double* C, F77_INT& LDC);
+}
+
+// Frobenius norm of a dense array of length len
+static double
+smith_fnorm (const double* x, octave_idx_type len)
+{
+    double scale = 0.0;
+    double ssq = 1.0;
+
+    for (octave_idx_type i = 0; i < len; i++)
+    {
+        if (x[i] != 0.0)
+        {
+            double absxi = std::abs (x[i]);
+
+            if (scale < absxi)
+            {
+                ssq = 1.0 + ssq * (scale/absxi) * (scale/absxi);
+                scale = absxi;
+            }
+            else
+                ssq += (absxi/scale) * (absxi/scale);
+        }
+    }
+
+    return scale * std::sqrt (ssq);
+}
+
+// PKG_ADD: autoload ("__sl_smith__", "__control_slicot_riccati__.oct");
+DEFUN_DLD (__sl_smith__, args, nargout,
+   "-*- texinfo -*-\n\
+Squared Smith iteration for discrete-time Lyapunov equations\n\
+No argument checking.\n\
+For internal use only.")
+{
+    octave_idx_type nargin = args.length ();
+    octave_value_list retval;
+
+    if (nargin != 4)
+    {
+        print_usage ();
+    }
+    else
+    {
+        // arguments in
+        Matrix a = args(0).matrix_value ();
+        Matrix x = args(1).matrix_value ();
+        double tol = args(2).double_value ();
+        F77_INT maxiter = args(3).int_value ();
+
+        F77_INT n = TO_F77_INT (a.rows ());
+        octave_idx_type nn = static_cast<octave_idx_type> (n) * n;
+
+        // workspace
+        Matrix t (n, n);
+        Matrix a2 (n, n);
+
+        double one = 1.0;
+        double zero = 0.0;
+        char tn = 'N';
+        char tt = 'T';
+
+        double* pa = a.fortran_vec ();
+        double* px = x.fortran_vec ();
+        double* pt = t.fortran_vec ();
+        double* pa2 = a2.fortran_vec ();
+
+        F77_INT iter = 0;
+        bool converged = (n == 0);
+
+        while (! converged && iter < maxiter)
+        {
+            octave_quit ();
+
+            // T = A(k) X(k)
+            CONTROL_XFCN (dgemm, DGEMM, (n, n, n, 0), (0),
+                         (tn, tn, n, n, n, one, pa, n, px, n, zero, pt, n));
+
+            // A2 = T A(k)' = A(k) X(k) A(k)'
+            CONTROL_XFCN (dgemm, DGEMM, (n, n, n, 0), (0),
+                         (tn, tt, n, n, n, one, pt, n, pa, n, zero, pa2, n));
+
+            double dnorm = smith_fnorm (pa2, nn);
+
+            for (octave_idx_type i = 0; i < nn; i++)
+                px[i] += pa2[i];
+
+            iter++;
+
+            double xnorm = smith_fnorm (px, nn);
+
+            if (! (dnorm == dnorm) || ! (xnorm == xnorm))    // NaN
+                break;
+
+            if (dnorm <= tol * xnorm)
+            {
+                converged = true;
+                break;
+            }
+
+            // A(k+1) = A(k)^2
+            CONTROL_XFCN (dgemm, DGEMM, (n, n, n, 0), (0),
+                         (tn, tn, n, n, n, one, pa, n, pa, n, zero, pa2, n));
+
+            std::copy (pa2, pa2 + nn, pa);
+        }
+
+        if (f77_exception_encountered)
+            error ("dlyap: __sl_smith__: exception in BLAS subroutine DGEMM");
+
+        // symmetrize
+        x = 0.5 * (x + x.transpose ());
+
+        // return values
+        retval(0) = x;
+        retval(1) = octave_value (iter);
+        retval(2) = octave_value (converged);
+    }
+
+    return retval;
+}
@@ -23,7 +23,7 @@ Uses SLICOT TB01ID by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: May 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -43,7 +43,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tb01id__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tb01id__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tb01id__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TB01ID Release 5.0\n\
@@ -85,15 +85,15 @@ For internal use only.")
 
 
         // SLICOT routine TB01ID
-        F77_XFCN (tb01id, TB01ID,
-                 (job,
-                  n, m, p,
-                  maxred,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  scale.fortran_vec (),
-                  info));
+        CONTROL_XFCN (tb01id, TB01ID, (n, m, p, 0), (info),
+                     (job,
+                      n, m, p,
+                      maxred,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      scale.fortran_vec (),
+                      info));
 
         if (f77_exception_encountered)
             error ("ss: prescale: __sl_tb01id__: exception in SLICOT subroutine TB01ID");
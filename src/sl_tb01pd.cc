@@ -23,7 +23,7 @@ Uses SLICOT TB01PD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: September 2010
-Version: 0.5
+Version: 0.6
 
 */
 
@@ -45,7 +45,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tb01pd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tb01pd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tb01pd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TB01PD Release 5.0\n\
@@ -99,25 +99,25 @@ For internal use only.")
         F77_INT liwork = n + max (m, p);
         F77_INT ldwork = max (1, n + max (n, 3*m, 3*p));
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info = 0;
 
 
         // SLICOT routine TB01PD
-        F77_XFCN (tb01pd, TB01PD,
-                 (job, equil,
-                  n, m, p,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  nr,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (tb01pd, TB01PD, (n, m, p, ldwork), (info),
+                     (job, equil,
+                      n, m, p,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      nr,
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("ss: minreal: __sl_tb01pd__: exception in SLICOT subroutine TB01PD");
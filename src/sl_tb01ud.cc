@@ -23,7 +23,7 @@ Uses SLICOT TB01UD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: October 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -48,7 +48,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tb01ud__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tb01ud__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tb01ud__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TB01UD Release 5.0\n\
@@ -87,34 +87,34 @@ For internal use only.")
         F77_INT ncont;
         F77_INT indcon;
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, nblk, n);
-        OCTAVE_LOCAL_BUFFER (double, tau, n);
+        CONTROL_WORK_BUFFER (F77_INT, nblk, n);
+        CONTROL_WORK_BUFFER (double, tau, n);
         
         // workspace
         F77_INT ldwork = max (1, n, 3*m, p);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, m);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, m);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info;
 
 
         // SLICOT routine TB01UD
-        F77_XFCN (tb01ud, TB01UD,
-                 (jobz,
-                  n, m, p,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  ncont, indcon,
-                  nblk,
-                  z.fortran_vec (), ldz,
-                  tau,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (tb01ud, TB01UD, (n, m, p, ldwork), (info),
+                     (jobz,
+                      n, m, p,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      ncont, indcon,
+                      nblk,
+                      z.fortran_vec (), ldz,
+                      tau,
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("__sl_tb01ud__: exception in SLICOT subroutine TB01UD");
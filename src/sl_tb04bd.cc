@@ -24,7 +24,7 @@ Uses SLICOT TB04BD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: October 2010
-Version: 0.3
+Version: 0.4
 
 */
 
@@ -49,7 +49,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tb04bd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tb04bd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tb04bd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TB04BD Release 5.0\n\
@@ -96,8 +96,8 @@ For internal use only.")
         F77_INT ldigd = max (1, p);
         F77_INT lg = p * m * md;
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, ign, ldign*m);
-        OCTAVE_LOCAL_BUFFER (F77_INT, igd, ldigd*m);
+        CONTROL_WORK_BUFFER (F77_INT, ign, ldign*m);
+        CONTROL_WORK_BUFFER (F77_INT, igd, ldigd*m);
 
         RowVector gn (lg);
         RowVector gd (lg);
@@ -108,28 +108,28 @@ For internal use only.")
         // workspace
         F77_INT ldwork = max (1, n*(n + p) + max (n + max (n, p), n*(2*n + 5)));
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, n);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, n);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
 
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine TB04BD
-        F77_XFCN (tb04bd, TB04BD,
-                 (jobd, order, equil,
-                  n, m, p, md,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  ign, ldign,
-                  igd, ldigd,
-                  gn.fortran_vec (), gd.fortran_vec (),
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (tb04bd, TB04BD, (n, m, p, ldwork), (info),
+                     (jobd, order, equil,
+                      n, m, p, md,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      ign, ldign,
+                      igd, ldigd,
+                      gn.fortran_vec (), gd.fortran_vec (),
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("ss2tf: __sl_tb04bd__: exception in SLICOT subroutine TB04BD");
@@ -26,7 +26,7 @@ Uses SLICOT TD04AD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: August 2011
-Version: 0.3
+Version: 0.4
 
 */
 
@@ -52,7 +52,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_td04ad__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_td04ad__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_td04ad__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TD04AD Release 5.0\n\
@@ -84,7 +84,7 @@ For internal use only.")
         F77_INT lduco2 = max (1, m);
         
         F77_INT n = 0;
-        OCTAVE_LOCAL_BUFFER (F77_INT, index, p);
+        CONTROL_WORK_BUFFER (F77_INT, index, p);
         for (F77_INT i = 0; i < p; i++)
         {
             index[i] = TO_F77_INT (indexd.xelem (i));
@@ -106,29 +106,29 @@ For internal use only.")
         // workspace
         F77_INT ldwork = max (1, n + max (n, 3*m, 3*p));
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, n + max (m, p));
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, n + max (m, p));
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
 
         // error indicator
         F77_INT info;
 
 
         // SLICOT routine TD04AD
-        F77_XFCN (td04ad, TD04AD,
-                 (rowcol,
-                  m, p,
-                  index,
-                  dcoeff.fortran_vec (), lddcoe,
-                  ucoeff.fortran_vec (), lduco1, lduco2,
-                  nr,
-                  a.fortran_vec (), lda,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  d.fortran_vec (), ldd,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (td04ad, TD04AD, (n, m, p, ldwork), (info),
+                     (rowcol,
+                      m, p,
+                      index,
+                      dcoeff.fortran_vec (), lddcoe,
+                      ucoeff.fortran_vec (), lduco1, lduco2,
+                      nr,
+                      a.fortran_vec (), lda,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      d.fortran_vec (), ldd,
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("tf2ss: __sl_td04ad__: exception in SLICOT subroutine TD04AD");
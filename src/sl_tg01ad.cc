@@ -23,7 +23,7 @@ Uses SLICOT TG01AD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: June 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -45,7 +45,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tg01ad__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tg01ad__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tg01ad__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TG01AD Release 5.0\n\
@@ -86,24 +86,24 @@ For internal use only.")
         ColumnVector rscale (n);
 
         // workspace
-        OCTAVE_LOCAL_BUFFER (double, dwork, 3*(l+n));
+        CONTROL_WORK_BUFFER (double, dwork, 3*(l+n));
 
         // error indicators
         F77_INT info = 0;
 
 
         // SLICOT routine TG01AD
-        F77_XFCN (tg01ad, TG01AD,
-                 (job,
-                  l, n, m, p,
-                  tresh,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  lscale.fortran_vec (), rscale.fortran_vec (),
-                  dwork,
-                  info));
+        CONTROL_XFCN (tg01ad, TG01AD, (n, m, p, 3*(l+n)), (info),
+                     (job,
+                      l, n, m, p,
+                      tresh,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      lscale.fortran_vec (), rscale.fortran_vec (),
+                      dwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("ss: prescale: __sl_tg01ad__: exception in SLICOT subroutine TG01AD");
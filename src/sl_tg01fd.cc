@@ -23,7 +23,7 @@ Uses SLICOT TG01FD by courtesy of NICONET e.V.
 
 Author: Thomas Vasileiou <thomas-v@wildmail.com>
 Created: September 2013
-Version: 0.2
+Version: 0.4
 
 */
 
@@ -48,7 +48,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tg01fd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tg01fd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tg01fd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TG01FD Release 5.0\n\
@@ -106,29 +106,30 @@ For internal use only.")
         F77_INT ranke, rnka22;
         
         // workspace
-        F77_INT ldwork = max (1, n+p, min (l,n) + max (3*n-1, m, l));
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, n);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        F77_INT ldwork = control_ldwork ("TG01FD", {l, n, m, p},
+                                         max (1, n+p, min (l,n) + max (3*n-1, m, l)), n);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, n);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info = 0;
 
 
         // SLICOT routine TG01FD
-        F77_XFCN (tg01fd, TG01FD,
-                 (compq, compz, joba,
-                  l, n, m, p,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  q.fortran_vec (), ldq,
-                  z.fortran_vec (), ldz,
-                  ranke, rnka22,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (tg01fd, TG01FD, (n, m, p, ldwork), (info),
+                     (compq, compz, joba,
+                      l, n, m, p,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      q.fortran_vec (), ldq,
+                      z.fortran_vec (), ldz,
+                      ranke, rnka22,
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("__sl_tg01fd__: exception in SLICOT subroutine TG01FD");
@@ -23,7 +23,7 @@ Uses SLICOT TG01HD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: September 2010
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -50,7 +50,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tg01hd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tg01hd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tg01hd__, args, nargout, "Slicot TG01HD Release 5.0")
 {
     octave_idx_type nargin = args.length ();
@@ -92,35 +92,35 @@ DEFUN_DLD (__sl_tg01hd__, args, nargout, "Slicot TG01HD Release 5.0")
         F77_INT niucon;
         F77_INT nrblck;
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, rtau, n);
+        CONTROL_WORK_BUFFER (F77_INT, rtau, n);
         
         // workspace
         F77_INT ldwork = max (n, 2*m);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, m);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, m);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info;
 
 
         // SLICOT routine TG01HD
-        F77_XFCN (tg01hd, TG01HD,
-                 (jobcon,
-                  compq, compz,
-                  n, m, p,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  q.fortran_vec (), ldq,
-                  z.fortran_vec (), ldz,
-                  ncont, niucon,
-                  nrblck,
-                  rtau,
-                  tol,
-                  iwork, dwork,
-                  info));
+        CONTROL_XFCN (tg01hd, TG01HD, (n, m, p, ldwork), (info),
+                     (jobcon,
+                      compq, compz,
+                      n, m, p,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      q.fortran_vec (), ldq,
+                      z.fortran_vec (), ldz,
+                      ncont, niucon,
+                      nrblck,
+                      rtau,
+                      tol,
+                      iwork, dwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("__sl_tg01hd__: exception in SLICOT subroutine TG01HD");
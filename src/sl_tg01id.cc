@@ -23,7 +23,7 @@ Uses SLICOT TG01ID by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: September 2010
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -50,7 +50,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tg01id__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tg01id__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tg01id__, args, nargout, "Slicot TG01ID Release 5.0")
 {
     octave_idx_type nargin = args.length ();
@@ -94,35 +94,35 @@ DEFUN_DLD (__sl_tg01id__, args, nargout, "Slicot TG01ID Release 5.0")
         F77_INT niuobs;
         F77_INT nlblck;
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, ctau, n);
+        CONTROL_WORK_BUFFER (F77_INT, ctau, n);
         
         // workspace
         F77_INT ldwork = max (n, 2*p);
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, p);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, p);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info;
 
 
         // SLICOT routine TG01ID
-        F77_XFCN (tg01id, TG01ID,
-                 (jobobs,
-                  compq, compz,
-                  n, m, p,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  q.fortran_vec (), ldq,
-                  z.fortran_vec (), ldz,
-                  nobsv, niuobs,
-                  nlblck,
-                  ctau,
-                  tol,
-                  iwork, dwork,
-                  info));
+        CONTROL_XFCN (tg01id, TG01ID, (n, m, p, ldwork), (info),
+                     (jobobs,
+                      compq, compz,
+                      n, m, p,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      q.fortran_vec (), ldq,
+                      z.fortran_vec (), ldz,
+                      nobsv, niuobs,
+                      nlblck,
+                      ctau,
+                      tol,
+                      iwork, dwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("__sl_tg01id__: exception in SLICOT subroutine TG01ID");
@@ -23,7 +23,7 @@ Uses SLICOT TG01JD by courtesy of NICONET e.V.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: September 2010
-Version: 0.5
+Version: 0.6
 
 */
 
@@ -47,7 +47,7 @@ extern "C"
                   F77_INT& INFO);
 }
 
-// PKG_ADD: autoload ("__sl_tg01jd__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tg01jd__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tg01jd__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TG01JD Release 5.0\n\
@@ -171,27 +171,27 @@ For internal use only.")
                 order reduction took place.
         */
 
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, liwork);
-        OCTAVE_LOCAL_BUFFER (double, dwork, ldwork);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, liwork);
+        CONTROL_WORK_BUFFER (double, dwork, ldwork);
         
         // error indicators
         F77_INT info = 0;
 
 
         // SLICOT routine TG01JD
-        F77_XFCN (tg01jd, TG01JD,
-                 (job, systyp, equil,
-                  n, m, p,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (), lde,
-                  b.fortran_vec (), ldb,
-                  c.fortran_vec (), ldc,
-                  nr,
-                  infred,
-                  tol,
-                  iwork,
-                  dwork, ldwork,
-                  info));
+        CONTROL_XFCN (tg01jd, TG01JD, (n, m, p, ldwork), (info),
+                     (job, systyp, equil,
+                      n, m, p,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (), lde,
+                      b.fortran_vec (), ldb,
+                      c.fortran_vec (), ldc,
+                      nr,
+                      infred,
+                      tol,
+                      iwork,
+                      dwork, ldwork,
+                      info));
 
         if (f77_exception_encountered)
             error ("dss: minreal: __sl_tg01jd__: exception in SLICOT subroutine TG01JD");
@@ -21,7 +21,7 @@ Gain of descriptor state-space models.  Based on SLICOT TB04BX.f.
 
 Author: Lukas Reichlin <lukas.reichlin@gmail.com>
 Created: March 2011
-Version: 0.2
+Version: 0.3
 
 */
 
@@ -45,7 +45,7 @@ extern "C"
                   F77_INT* IWORK);
 }
 
-// PKG_ADD: autoload ("__sl_tg04bx__", "__control_slicot_functions__.oct");    
+// PKG_ADD: autoload ("__sl_tg04bx__", "__control_slicot_realization__.oct");    
 DEFUN_DLD (__sl_tg04bx__, args, nargout,
    "-*- texinfo -*-\n\
 Slicot TG04BX Release 5.0\n\
@@ -91,20 +91,20 @@ For internal use only.")
         double gain;
 
         // workspace
-        OCTAVE_LOCAL_BUFFER (F77_INT, iwork, lda);
+        CONTROL_WORK_BUFFER (F77_INT, iwork, lda);
 
         
-        F77_XFCN (tg04bx, TG04BX,
-                 (ip, iz,
-                  a.fortran_vec (), lda,
-                  e.fortran_vec (),
-                  b.fortran_vec (),
-                  c.fortran_vec (),
-                  d.fortran_vec (),
-                  pr.fortran_vec (), pi.fortran_vec (),
-                  zr.fortran_vec (), zi.fortran_vec (),
-                  gain,
-                  iwork));
+        CONTROL_XFCN (tg04bx, TG04BX, (n, 0, 0, 0), (0),
+                     (ip, iz,
+                      a.fortran_vec (), lda,
+                      e.fortran_vec (),
+                      b.fortran_vec (),
+                      c.fortran_vec (),
+                      d.fortran_vec (),
+                      pr.fortran_vec (), pi.fortran_vec (),
+                      zr.fortran_vec (), zi.fortran_vec (),
+                      gain,
+                      iwork));
                   
         if (f77_exception_encountered)
             error ("dss: zero: __sl_tg04bx__: exception in TG04BX");